@@ -0,0 +1,52 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#ifndef TUYUIDCARD_BILINEAR_H_
+#define TUYUIDCARD_BILINEAR_H_
+
+#include <cmath>
+#include <cstddef>
+
+// Helpers of the fused bilinear resize kernels of the detector and the
+// recognizer. Sampling follows cv::resize with INTER_LINEAR: half pixel
+// centers and clamped borders.
+
+// Source coordinate of output pixel dst and the weight of its right/bottom
+// neighbour.
+inline void BilinearCoord(int dst, double scale, int src_size, int* ofs,
+                          float* alpha) {
+  double s = (dst + 0.5) * scale - 0.5;
+  int i = int(std::floor(s));
+  float a = float(s - i);
+  if (i < 0) {
+    i = 0;
+    a = 0;
+  }
+  if (i >= src_size - 1) {
+    i = src_size - 1;
+    a = 0;
+  }
+  *ofs = i;
+  *alpha = a;
+}
+
+// Horizontal pass of one 8-bit BGR source row into dst_w float pixels. R, G
+// and B of pixel x go to r, g and b at x * stride, so stride 3 with
+// r = row, g = row + 1, b = row + 2 writes interleaved RGB and stride 1
+// with three plane pointers writes planar RGB.
+inline void BilinearRowBGR(const unsigned char* src, int src_w,
+                           const int* xofs, const float* xalpha, int dst_w,
+                           float* r, float* g, float* b, size_t stride) {
+  for (int x = 0; x < dst_w; x++) {
+    const unsigned char* p0 = src + xofs[x] * 3;
+    const unsigned char* p1 = xofs[x] + 1 < src_w ? p0 + 3 : p0;
+    float a = xalpha[x];
+    float c = 1.0f - a;
+    r[x * stride] = p0[2] * c + p1[2] * a;
+    g[x * stride] = p0[1] * c + p1[1] * a;
+    b[x * stride] = p0[0] * c + p1[0] * a;
+  }
+}
+
+#endif  // TUYUIDCARD_BILINEAR_H_
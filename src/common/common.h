@@ -13,7 +13,7 @@
 
 #else
 // other os
-#define TAISHANOCR_API
+#define TUYUIDCARD_API
 #endif
 
 
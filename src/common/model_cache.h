@@ -0,0 +1,205 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#ifndef TUYUIDCARD_MODEL_CACHE_H_
+#define TUYUIDCARD_MODEL_CACHE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+#include "common/session_config.h"
+#include "common/ort_status.h"
+#include "onnxruntime_c_api.h"
+
+// Paths are UTF-8, onnxruntime takes UTF-16 paths on Windows.
+inline std::basic_string<ORTCHAR_T> ToOrtPath(const std::string& path) {
+#ifdef _WIN32
+  std::wstring wide;
+  int size = MultiByteToWideChar(CP_UTF8, 0, path.data(), int(path.size()),
+                                 NULL, 0);
+  if (size > 0) {
+    wide.resize(size);
+    MultiByteToWideChar(CP_UTF8, 0, path.data(), int(path.size()), &wide[0],
+                        size);
+  }
+  return wide;
+#else
+  return path;
+#endif
+}
+
+// The instruction sets onnxruntime picks CPU kernels and layouts for. A model
+// optimized at ORT_ENABLE_ALL may only run correctly on CPUs with the same
+// ones, so they are part of the cache key.
+inline std::string CpuFeatureKey() {
+  std::string key;
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+  key = "x86";
+  if (__builtin_cpu_supports("avx")) key += "+avx";
+  if (__builtin_cpu_supports("avx2")) key += "+avx2";
+  if (__builtin_cpu_supports("fma")) key += "+fma";
+  if (__builtin_cpu_supports("avx512f")) key += "+avx512f";
+  if (__builtin_cpu_supports("avx512bw")) key += "+avx512bw";
+  if (__builtin_cpu_supports("avx512vl")) key += "+avx512vl";
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int info[4];
+  __cpuid(info, 0);
+  int max_leaf = info[0];
+  __cpuid(info, 1);
+  key = "x86";
+  if (info[2] & (1 << 28)) key += "+avx";
+  bool fma = (info[2] & (1 << 12)) != 0;
+  if (max_leaf >= 7) {
+    __cpuidex(info, 7, 0);
+    if (info[1] & (1 << 5)) key += "+avx2";
+    if (fma) key += "+fma";
+    if (info[1] & (1 << 16)) key += "+avx512f";
+    if (info[1] & (1 << 30)) key += "+avx512bw";
+    if (info[1] & (1u << 31)) key += "+avx512vl";
+  } else if (fma) {
+    key += "+fma";
+  }
+#elif defined(__aarch64__) || defined(_M_ARM64)
+  key = "arm64";
+#else
+  key = "cpu";
+#endif
+  return key;
+}
+
+// FNV-1a over the model bytes and everything else that changes the optimized
+// graph, including the CPU features. Returns an empty string when the model
+// can not be read.
+inline std::string ModelFingerprint(const std::string& model_path,
+                                    const SessionConfig& config) {
+  std::ifstream file(model_path.c_str(), std::ios::binary);
+  if (!file.good()) {
+    return std::string();
+  }
+  uint64_t hash = 14695981039346656037ULL;
+  auto update = [&hash](const char* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 1099511628211ULL;
+    }
+  };
+  char buffer[64 * 1024];
+  while (file) {
+    file.read(buffer, sizeof(buffer));
+    update(buffer, static_cast<size_t>(file.gcount()));
+  }
+  std::string extra = OrtGetApiBase()->GetVersionString();
+  extra += "/" + std::to_string(int(config.graph_optimization_level));
+  extra += "/" + CpuFeatureKey();
+  for (const auto& dim : config.free_dimension_overrides) {
+    extra += "/" + dim.first + "=" + std::to_string(dim.second);
+  }
+  update(extra.data(), extra.size());
+
+  char hex[17];
+  snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+  return hex;
+}
+
+// <dir>/<model name>.<fingerprint><extension>, a file of the cache that
+// belongs to this model and config.
+inline std::string CachedFilePath(const std::string& model_path,
+                                  const SessionConfig& config,
+                                  const std::string& extension) {
+  std::string fingerprint = ModelFingerprint(model_path, config);
+  if (fingerprint.empty()) {
+    return std::string();
+  }
+  size_t slash = model_path.find_last_of("/\\");
+  std::string name =
+      slash == std::string::npos ? model_path : model_path.substr(slash + 1);
+  size_t dot = name.rfind('.');
+  if (dot != std::string::npos && dot > 0) {
+    name = name.substr(0, dot);
+  }
+  std::string dir = config.optimized_model_dir;
+  if (dir.back() != '/' && dir.back() != '\\') {
+    dir += '/';
+  }
+  return dir + name + "." + fingerprint + extension;
+}
+
+// <dir>/<model name>.<fingerprint>.ort
+inline std::string OptimizedModelPath(const std::string& model_path,
+                                      const SessionConfig& config) {
+  return CachedFilePath(model_path, config, ".ort");
+}
+
+// Creates the session, going through the optimized model cache when
+// config.optimized_model_dir is set. A cached artifact whose fingerprint
+// matches is loaded without running graph optimizations again; otherwise
+// the model is optimized as usual and the result is written to the cache.
+inline OrtStatus* CreateSessionWithCache(const OrtApi* ort_api,
+                                         const OrtEnv* env,
+                                         const std::string& model_path,
+                                         const SessionConfig& config,
+                                         OrtSessionOptions* session_options,
+                                         OrtSession** session) {
+  std::string cache_path;
+  if (!config.optimized_model_dir.empty()) {
+    cache_path = OptimizedModelPath(model_path, config);
+  }
+  if (cache_path.empty()) {
+    return ort_api->CreateSession(env, ToOrtPath(model_path).c_str(),
+                                  session_options, session);
+  }
+
+  if (std::ifstream(cache_path.c_str(), std::ios::binary).good()) {
+    ORT_RETURN_ON_ERROR(ort_api->SetSessionGraphOptimizationLevel(
+        session_options, ORT_DISABLE_ALL));
+    OrtStatus* status = ort_api->CreateSession(
+        env, ToOrtPath(cache_path).c_str(), session_options, session);
+    if (status == NULL) {
+      return NULL;
+    }
+    // unreadable artifact, rebuild it from the original model
+    fprintf(stderr, "ignore optimized model %s: %s\n", cache_path.c_str(),
+            ort_api->GetErrorMessage(status));
+    ort_api->ReleaseStatus(status);
+    ORT_RETURN_ON_ERROR(ort_api->SetSessionGraphOptimizationLevel(
+        session_options, config.graph_optimization_level));
+  }
+
+  // write under a unique name and rename, concurrent loaders (e.g. the
+  // workers of IDCardOCRPool) never see a partial file
+  size_t unique = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+                  static_cast<size_t>(std::chrono::steady_clock::now()
+                                          .time_since_epoch()
+                                          .count());
+  std::string tmp_path = cache_path + "." + std::to_string(unique) + ".tmp";
+  ORT_RETURN_ON_ERROR(ort_api->AddSessionConfigEntry(
+      session_options, "session.save_model_format", "ORT"));
+  ORT_RETURN_ON_ERROR(ort_api->SetOptimizedModelFilePath(
+      session_options, ToOrtPath(tmp_path).c_str()));
+  ORT_RETURN_ON_ERROR(ort_api->CreateSession(
+      env, ToOrtPath(model_path).c_str(), session_options, session));
+  if (std::rename(tmp_path.c_str(), cache_path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+  }
+  return NULL;
+}
+
+#endif  // TUYUIDCARD_MODEL_CACHE_H_
@@ -0,0 +1,20 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#ifndef TUYUIDCARD_ORT_STATUS_H_
+#define TUYUIDCARD_ORT_STATUS_H_
+
+#include "onnxruntime_c_api.h"
+
+// Returns the status of a failed onnxruntime call to the caller, for
+// helpers that report errors as OrtStatus* instead of aborting.
+#define ORT_RETURN_ON_ERROR(expr)    \
+  do {                               \
+    OrtStatus* onnx_status = (expr); \
+    if (onnx_status != NULL) {       \
+      return onnx_status;            \
+    }                                \
+  } while (0)
+
+#endif  // TUYUIDCARD_ORT_STATUS_H_
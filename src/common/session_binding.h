@@ -0,0 +1,257 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#ifndef TUYUIDCARD_SESSION_BINDING_H_
+#define TUYUIDCARD_SESSION_BINDING_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "common/ort_status.h"
+#include "onnxruntime_c_api.h"
+
+// A persistent IoBinding of a session with one float input and float
+// outputs. The input tensor wraps a caller owned buffer and is recreated
+// only when its pointer or shape changes. Outputs go to buffers owned by the
+// binding: the first run with a new input shape lets onnxruntime allocate
+// them to learn their shapes, later runs with that shape write straight into
+// the pre-bound buffers, so no tensor is allocated per call. Only the
+// output shapes of the kMaxShapes most recently used input shapes are
+// kept, so arbitrary input widths cannot grow the cache without bound.
+class SessionBinding {
+ public:
+  SessionBinding()
+      : ort_api_(NULL),
+        session_(NULL),
+        memory_info_(NULL),
+        binding_(NULL),
+        input_value_(NULL),
+        input_data_(NULL),
+        use_count_(0) {}
+  ~SessionBinding() { Release(); }
+
+  OrtStatus* Init(const OrtApi* ort_api, OrtSession* session,
+                  const char* input_name,
+                  const std::vector<const char*>& output_names) {
+    Release();
+    ort_api_ = ort_api;
+    session_ = session;
+    input_name_ = input_name;
+    output_names_.assign(output_names.begin(), output_names.end());
+    outputs_.clear();
+    outputs_.resize(output_names.size());
+    shape_cache_.clear();
+    ORT_RETURN_ON_ERROR(ort_api_->CreateCpuMemoryInfo(
+        OrtArenaAllocator, OrtMemTypeDefault, &memory_info_));
+    ORT_RETURN_ON_ERROR(ort_api_->CreateIoBinding(session_, &binding_));
+    return NULL;
+  }
+
+  // Binds data with the given shape as the input.
+  OrtStatus* BindInput(float* data, const std::vector<int64_t>& shape) {
+    if (input_value_ != NULL && data == input_data_ && shape == input_shape_) {
+      return NULL;
+    }
+    ReleaseValue(input_value_);
+    input_data_ = data;
+    input_shape_ = shape;
+    ORT_RETURN_ON_ERROR(ort_api_->CreateTensorWithDataAsOrtValue(
+        memory_info_, data, ElementCount(shape) * sizeof(float), shape.data(),
+        shape.size(), ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &input_value_));
+    ORT_RETURN_ON_ERROR(
+        ort_api_->BindInput(binding_, input_name_.c_str(), input_value_));
+    return NULL;
+  }
+
+  // Runs the session on the bound input. The outputs stay valid until the
+  // next Run.
+  OrtStatus* Run() {
+    ShapeEntry* entry = FindShapes(input_shape_);
+    if (entry == NULL) {
+      return RunAndLearnShapes();
+    }
+    if (!OutputsBoundTo(entry->output_shapes)) {
+      ORT_RETURN_ON_ERROR(BindOutputs(entry->output_shapes));
+    }
+    return ort_api_->RunWithBinding(session_, NULL, binding_);
+  }
+
+  // Frees the binding and its tensors, must happen before the session is
+  // released.
+  void Release() {
+    if (ort_api_ == NULL) return;
+    for (Output& output : outputs_) {
+      ReleaseValue(output.value);
+    }
+    ReleaseValue(input_value_);
+    if (binding_ != NULL) {
+      ort_api_->ReleaseIoBinding(binding_);
+      binding_ = NULL;
+    }
+    if (memory_info_ != NULL) {
+      ort_api_->ReleaseMemoryInfo(memory_info_);
+      memory_info_ = NULL;
+    }
+  }
+
+  const float* output(size_t i) const { return outputs_[i].buffer.data(); }
+  const std::vector<int64_t>& output_shape(size_t i) const {
+    return outputs_[i].shape;
+  }
+
+ private:
+  static const size_t kMaxShapes = 16;
+
+  // output shapes seen for an input shape
+  struct ShapeEntry {
+    std::vector<int64_t> input_shape;
+    std::vector<std::vector<int64_t>> output_shapes;
+    uint64_t last_use;
+  };
+
+  struct Output {
+    Output() : value(NULL) {}
+    std::vector<float> buffer;
+    std::vector<int64_t> shape;
+    // wraps buffer, NULL while the output is bound to the device
+    OrtValue* value;
+  };
+
+  static size_t ElementCount(const std::vector<int64_t>& shape) {
+    size_t count = 1;
+    for (int64_t dim : shape) {
+      count *= size_t(dim);
+    }
+    return count;
+  }
+
+  void ReleaseValue(OrtValue*& value) {
+    if (value != NULL) {
+      ort_api_->ReleaseValue(value);
+      value = NULL;
+    }
+  }
+
+  bool OutputsBoundTo(const std::vector<std::vector<int64_t>>& shapes) const {
+    for (size_t i = 0; i < outputs_.size(); i++) {
+      if (outputs_[i].value == NULL || outputs_[i].shape != shapes[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  OrtStatus* BindOutputs(const std::vector<std::vector<int64_t>>& shapes) {
+    for (size_t i = 0; i < outputs_.size(); i++) {
+      Output& output = outputs_[i];
+      ReleaseValue(output.value);
+      output.shape = shapes[i];
+      output.buffer.resize(ElementCount(output.shape));
+      ORT_RETURN_ON_ERROR(ort_api_->CreateTensorWithDataAsOrtValue(
+          memory_info_, output.buffer.data(),
+          output.buffer.size() * sizeof(float), output.shape.data(),
+          output.shape.size(), ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT,
+          &output.value));
+      ORT_RETURN_ON_ERROR(ort_api_->BindOutput(
+          binding_, output_names_[i].c_str(), output.value));
+    }
+    return NULL;
+  }
+
+  // Runs with the outputs allocated by onnxruntime, then copies them into
+  // the owned buffers and remembers their shapes for this input shape.
+  OrtStatus* RunAndLearnShapes() {
+    for (size_t i = 0; i < outputs_.size(); i++) {
+      ReleaseValue(outputs_[i].value);
+      ORT_RETURN_ON_ERROR(ort_api_->BindOutputToDevice(
+          binding_, output_names_[i].c_str(), memory_info_));
+    }
+    ORT_RETURN_ON_ERROR(ort_api_->RunWithBinding(session_, NULL, binding_));
+
+    OrtAllocator* allocator;
+    ORT_RETURN_ON_ERROR(ort_api_->GetAllocatorWithDefaultOptions(&allocator));
+    OrtValue** values = NULL;
+    size_t count = 0;
+    ORT_RETURN_ON_ERROR(
+        ort_api_->GetBoundOutputValues(binding_, allocator, &values, &count));
+    OrtStatus* status = NULL;
+    std::vector<std::vector<int64_t>> shapes(count);
+    for (size_t i = 0; i < count && status == NULL; i++) {
+      status = CopyOutput(values[i], outputs_[i]);
+      shapes[i] = outputs_[i].shape;
+    }
+    for (size_t i = 0; i < count; i++) {
+      ort_api_->ReleaseValue(values[i]);
+    }
+    ort_api_->AllocatorFree(allocator, values);
+    if (status == NULL) {
+      RememberShapes(shapes);
+    }
+    return status;
+  }
+
+  ShapeEntry* FindShapes(const std::vector<int64_t>& input_shape) {
+    for (ShapeEntry& entry : shape_cache_) {
+      if (entry.input_shape == input_shape) {
+        entry.last_use = ++use_count_;
+        return &entry;
+      }
+    }
+    return NULL;
+  }
+
+  // Adds the shapes of the current input, replacing the least recently
+  // used entry when the cache is full.
+  void RememberShapes(const std::vector<std::vector<int64_t>>& shapes) {
+    ShapeEntry entry = {input_shape_, shapes, ++use_count_};
+    if (shape_cache_.size() < kMaxShapes) {
+      shape_cache_.push_back(entry);
+      return;
+    }
+    size_t oldest = 0;
+    for (size_t i = 1; i < shape_cache_.size(); i++) {
+      if (shape_cache_[i].last_use < shape_cache_[oldest].last_use) {
+        oldest = i;
+      }
+    }
+    shape_cache_[oldest] = entry;
+  }
+
+  OrtStatus* CopyOutput(OrtValue* value, Output& output) {
+    OrtTensorTypeAndShapeInfo* info;
+    ORT_RETURN_ON_ERROR(ort_api_->GetTensorTypeAndShape(value, &info));
+    size_t num_dims = 0;
+    OrtStatus* status = ort_api_->GetDimensionsCount(info, &num_dims);
+    if (status == NULL) {
+      output.shape.resize(num_dims);
+      status = ort_api_->GetDimensions(info, output.shape.data(), num_dims);
+    }
+    ort_api_->ReleaseTensorTypeAndShapeInfo(info);
+    ORT_RETURN_ON_ERROR(status);
+    float* data;
+    ORT_RETURN_ON_ERROR(ort_api_->GetTensorMutableData(value, (void**)&data));
+    output.buffer.assign(data, data + ElementCount(output.shape));
+    return NULL;
+  }
+
+  const OrtApi* ort_api_;
+  OrtSession* session_;
+  OrtMemoryInfo* memory_info_;
+  OrtIoBinding* binding_;
+
+  std::string input_name_;
+  OrtValue* input_value_;
+  float* input_data_;
+  std::vector<int64_t> input_shape_;
+
+  std::vector<std::string> output_names_;
+  std::vector<Output> outputs_;
+  std::vector<ShapeEntry> shape_cache_;
+  uint64_t use_count_;
+
+  SessionBinding(const SessionBinding&);
+  SessionBinding& operator=(const SessionBinding&);
+};
+
+#endif  // TUYUIDCARD_SESSION_BINDING_H_
@@ -0,0 +1,107 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#ifndef TUYUIDCARD_SESSION_CONFIG_H_
+#define TUYUIDCARD_SESSION_CONFIG_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "common/ort_status.h"
+#include "onnxruntime_c_api.h"
+
+// Threading and execution options of the detector/recognizer sessions. The
+// defaults keep one intra-op thread per session, which suits running many
+// sessions side by side (see IDCardOCRPool). Thread counts <= 0 leave the
+// choice to onnxruntime.
+struct SessionConfig {
+  int intra_op_num_threads = 1;
+  // only used with ORT_PARALLEL
+  int inter_op_num_threads = 0;
+  ExecutionMode execution_mode = ORT_SEQUENTIAL;
+  // busy-wait for work instead of sleeping, lower latency but burns CPU
+  bool allow_spinning = true;
+  bool enable_mem_pattern = true;
+  bool enable_cpu_mem_arena = true;
+  // Run on the thread pools of the env instead of per-session pools. The env
+  // must be created by CreateEnvWithGlobalThreadPools, e.g. through
+  // CreateSharedEnv below; the per-session thread counts are then ignored.
+  bool use_global_thread_pool = false;
+  GraphOptimizationLevel graph_optimization_level = ORT_ENABLE_ALL;
+  // When set, the optimized graph is saved here in ORT format on first load
+  // and loaded directly on later starts (see common/model_cache.h).
+  std::string optimized_model_dir;
+  // Symbolic input dimensions pinned to a fixed size, which lets the graph
+  // optimizations and memory planning work on static shapes.
+  std::vector<std::pair<std::string, int64_t>> free_dimension_overrides;
+};
+
+// Fills freshly created session options from the config.
+inline OrtStatus* ApplySessionConfig(const OrtApi* ort_api,
+                                     const SessionConfig& config,
+                                     OrtSessionOptions* session_options) {
+  if (config.use_global_thread_pool) {
+    ORT_RETURN_ON_ERROR(ort_api->DisablePerSessionThreads(session_options));
+  } else {
+    if (config.intra_op_num_threads > 0) {
+      ORT_RETURN_ON_ERROR(ort_api->SetIntraOpNumThreads(
+          session_options, config.intra_op_num_threads));
+    }
+    if (config.inter_op_num_threads > 0) {
+      ORT_RETURN_ON_ERROR(ort_api->SetInterOpNumThreads(
+          session_options, config.inter_op_num_threads));
+    }
+    const char* spinning = config.allow_spinning ? "1" : "0";
+    ORT_RETURN_ON_ERROR(ort_api->AddSessionConfigEntry(
+        session_options, "session.intra_op.allow_spinning", spinning));
+    ORT_RETURN_ON_ERROR(ort_api->AddSessionConfigEntry(
+        session_options, "session.inter_op.allow_spinning", spinning));
+  }
+  ORT_RETURN_ON_ERROR(
+      ort_api->SetSessionExecutionMode(session_options, config.execution_mode));
+  ORT_RETURN_ON_ERROR(
+      config.enable_mem_pattern ? ort_api->EnableMemPattern(session_options)
+                                : ort_api->DisableMemPattern(session_options));
+  ORT_RETURN_ON_ERROR(
+      config.enable_cpu_mem_arena
+          ? ort_api->EnableCpuMemArena(session_options)
+          : ort_api->DisableCpuMemArena(session_options));
+  ORT_RETURN_ON_ERROR(ort_api->SetSessionGraphOptimizationLevel(
+      session_options, config.graph_optimization_level));
+  for (const auto& dim : config.free_dimension_overrides) {
+    ORT_RETURN_ON_ERROR(ort_api->AddFreeDimensionOverrideByName(
+        session_options, dim.first.c_str(), dim.second));
+  }
+  return NULL;
+}
+
+// Creates an env with global thread pools sized from the config, for
+// sessions with use_global_thread_pool set.
+inline OrtStatus* CreateSharedEnv(const OrtApi* ort_api,
+                                  const SessionConfig& config,
+                                  const char* logid, OrtEnv** env) {
+  OrtThreadingOptions* threading_options;
+  ORT_RETURN_ON_ERROR(ort_api->CreateThreadingOptions(&threading_options));
+  OrtStatus* status = NULL;
+  if (config.intra_op_num_threads > 0) {
+    status = ort_api->SetGlobalIntraOpNumThreads(threading_options,
+                                                 config.intra_op_num_threads);
+  }
+  if (status == NULL && config.inter_op_num_threads > 0) {
+    status = ort_api->SetGlobalInterOpNumThreads(threading_options,
+                                                 config.inter_op_num_threads);
+  }
+  if (status == NULL) {
+    status = ort_api->SetGlobalSpinControl(threading_options,
+                                           config.allow_spinning ? 1 : 0);
+  }
+  if (status == NULL) {
+    status = ort_api->CreateEnvWithGlobalThreadPools(
+        ORT_LOGGING_LEVEL_WARNING, logid, threading_options, env);
+  }
+  ort_api->ReleaseThreadingOptions(threading_options);
+  return status;
+}
+
+#endif  // TUYUIDCARD_SESSION_CONFIG_H_
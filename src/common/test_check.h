@@ -0,0 +1,37 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#ifndef TUYUIDCARD_TEST_CHECK_H_
+#define TUYUIDCARD_TEST_CHECK_H_
+
+#include <cstdio>
+
+// Minimal checks for the self-contained test programs: a failed EXPECT
+// prints where and why, and main returns TestResult() so ctest sees it.
+inline int& TestFailures() {
+  static int failures = 0;
+  return failures;
+}
+
+#define EXPECT(cond, ...)                                       \
+  do {                                                          \
+    if (!(cond)) {                                              \
+      fprintf(stderr, "%s:%d: EXPECT(%s) failed: ", __FILE__,   \
+              __LINE__, #cond);                                 \
+      fprintf(stderr, __VA_ARGS__);                             \
+      fprintf(stderr, "\n");                                    \
+      TestFailures()++;                                         \
+    }                                                           \
+  } while (0)
+
+inline int TestResult() {
+  if (TestFailures() == 0) {
+    printf("all checks passed\n");
+    return 0;
+  }
+  printf("%d checks failed\n", TestFailures());
+  return 1;
+}
+
+#endif  // TUYUIDCARD_TEST_CHECK_H_
@@ -7,6 +7,9 @@
 #include <fstream>
 #include <iostream>
 #include "det/lanms.hpp"
+#include "det/rbox_decoder.h"
+#include "det/resize_kernel.h"
+#include "common/model_cache.h"
 #include "spdlog/spdlog.h"
 using namespace lanms;
 
@@ -22,6 +25,7 @@ using namespace lanms;
   } while (0);
 
 Detector::~Detector() {
+  binding_.Release();
   if (session_ != nullptr) {
     ort_api_->ReleaseSession(session_);
   }
@@ -30,18 +34,158 @@ Detector::~Detector() {
   }
 }
 
-void Detector::InitModel(const std::string& model_path) {
-  ORT_ABORT_ON_ERROR(ort_api_->CreateSessionOptions(&session_options_));
-  ort_api_->SetIntraOpNumThreads(session_options_, 1);
-  ort_api_->SetSessionGraphOptimizationLevel(session_options_, ORT_ENABLE_ALL);
-#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
-  std::wstring w_model_path;
-  ORT_ABORT_ON_ERROR(ort_api_->CreateSession(env_, w_model_path.c_str(),
-                                             session_options_, &session_));
-#else 
-  ORT_ABORT_ON_ERROR(ort_api_->CreateSession(env_, model_path.c_str(),
-      session_options_, &session_));
-#endif 
+bool Detector::InitModel(const std::string& model_path,
+                         const SessionConfig& config) {
+  OrtStatus* status = LoadModel(model_path, config);
+  if (status != NULL) {
+    fprintf(stderr, "%s\n", ort_api_->GetErrorMessage(status));
+    ort_api_->ReleaseStatus(status);
+    return false;
+  }
+  return true;
+}
+
+OrtStatus* Detector::LoadModel(const std::string& model_path,
+                               const SessionConfig& config) {
+  SessionConfig session_config = config;
+  if (config_.fixed_shape) {
+    config_.fixed_width = std::max(32, config_.fixed_width / 32 * 32);
+    config_.fixed_height = std::max(32, config_.fixed_height / 32 * 32);
+    ORT_RETURN_ON_ERROR(PinInputShape(model_path, session_config));
+  }
+  ORT_RETURN_ON_ERROR(ort_api_->CreateSessionOptions(&session_options_));
+  ORT_RETURN_ON_ERROR(
+      ApplySessionConfig(ort_api_, session_config, session_options_));
+  ORT_RETURN_ON_ERROR(CreateSessionWithCache(ort_api_, env_, model_path,
+                                             session_config, session_options_,
+                                             &session_));
+  return binding_.Init(ort_api_, session_, "input", {"geo_map", "score_map"});
+}
+
+// One "<size> <name>" line per input dim, size -1 for symbolic dims.
+static bool ReadInputDims(const std::string& path, std::vector<int64_t>& dims,
+                          std::vector<std::string>& names) {
+  std::ifstream file(path.c_str());
+  if (!file.good()) return false;
+  dims.clear();
+  names.clear();
+  int64_t size;
+  while (file >> size) {
+    std::string name;
+    std::getline(file, name);
+    if (!name.empty() && name[0] == ' ') name.erase(0, 1);
+    dims.push_back(size);
+    names.push_back(name);
+  }
+  return !dims.empty();
+}
+
+static void WriteInputDims(const std::string& path,
+                           const std::vector<int64_t>& dims,
+                           const std::vector<std::string>& names) {
+  // written aside and renamed like the optimized model
+  size_t unique = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+                  static_cast<size_t>(std::chrono::steady_clock::now()
+                                          .time_since_epoch()
+                                          .count());
+  std::string tmp_path = path + "." + std::to_string(unique) + ".tmp";
+  std::ofstream file(tmp_path.c_str());
+  for (size_t i = 0; i < dims.size(); i++) {
+    file << dims[i] << " " << names[i] << "\n";
+  }
+  file.close();
+  if (file.fail()) {
+    std::remove(tmp_path.c_str());
+    return;
+  }
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+  }
+}
+
+OrtStatus* Detector::PinInputShape(const std::string& model_path,
+                                   SessionConfig& config) {
+  std::vector<int64_t> dims;
+  std::vector<std::string> names;
+  std::string dims_path;
+  if (!config.optimized_model_dir.empty()) {
+    dims_path = CachedFilePath(model_path, config, ".dims");
+  }
+  if (dims_path.empty() || !ReadInputDims(dims_path, dims, names)) {
+    ORT_RETURN_ON_ERROR(ProbeInputDims(model_path, dims, names));
+    if (!dims_path.empty()) {
+      WriteInputDims(dims_path, dims, names);
+    }
+  }
+
+  // input is NHWC
+  int64_t fixed[4] = {1, config_.fixed_height, config_.fixed_width, 3};
+  for (size_t i = 0; i < dims.size() && i < 4; i++) {
+    if (dims[i] > 0) {
+      // already static in the model, the canvas has to follow it
+      if (i == 1) config_.fixed_height = int(dims[i]);
+      if (i == 2) config_.fixed_width = int(dims[i]);
+    } else if (!names[i].empty()) {
+      config.free_dimension_overrides.emplace_back(names[i], fixed[i]);
+    } else {
+      SPDLOG_WARN("input dim {} of the detector has no name to pin", i);
+    }
+  }
+  return NULL;
+}
+
+// Sizes and symbolic names of the dims of the first input of a session.
+static OrtStatus* SessionInputDims(const OrtApi* ort_api, OrtSession* session,
+                                   std::vector<int64_t>& dims,
+                                   std::vector<std::string>& names) {
+  OrtTypeInfo* typeinfo;
+  ORT_RETURN_ON_ERROR(ort_api->SessionGetInputTypeInfo(session, 0, &typeinfo));
+  const OrtTensorTypeAndShapeInfo* tensor_info;
+  size_t num_dims = 0;
+  OrtStatus* status = ort_api->CastTypeInfoToTensorInfo(typeinfo, &tensor_info);
+  if (status == NULL) {
+    status = ort_api->GetDimensionsCount(tensor_info, &num_dims);
+  }
+  dims.resize(num_dims);
+  std::vector<const char*> symbolic(num_dims);
+  if (status == NULL) {
+    status = ort_api->GetDimensions(tensor_info, dims.data(), num_dims);
+  }
+  if (status == NULL) {
+    status = ort_api->GetSymbolicDimensions(tensor_info, symbolic.data(),
+                                            num_dims);
+  }
+  names.assign(num_dims, std::string());
+  for (size_t i = 0; i < num_dims && status == NULL; i++) {
+    if (dims[i] <= 0 && symbolic[i] != NULL) names[i] = symbolic[i];
+  }
+  ort_api->ReleaseTypeInfo(typeinfo);
+  return status;
+}
+
+OrtStatus* Detector::ProbeInputDims(const std::string& model_path,
+                                    std::vector<int64_t>& dims,
+                                    std::vector<std::string>& names) {
+  OrtSessionOptions* options;
+  ORT_RETURN_ON_ERROR(ort_api_->CreateSessionOptions(&options));
+  OrtSession* probe = NULL;
+  OrtStatus* status =
+      ort_api_->SetSessionGraphOptimizationLevel(options, ORT_DISABLE_ALL);
+  if (status == NULL) {
+    status = ort_api_->SetIntraOpNumThreads(options, 1);
+  }
+  if (status == NULL) {
+    status = ort_api_->CreateSession(env_, ToOrtPath(model_path).c_str(),
+                                     options, &probe);
+  }
+  if (status == NULL) {
+    status = SessionInputDims(ort_api_, probe, dims, names);
+  }
+  if (probe != NULL) {
+    ort_api_->ReleaseSession(probe);
+  }
+  ort_api_->ReleaseSessionOptions(options);
+  return status;
 }
 
 void Detector::GetInputs() {
@@ -100,16 +244,26 @@ void Detector::GetTensorDataAndShape(OrtValue* input_map, float** array,
   ort_api_->ReleaseTensorTypeAndShapeInfo(tensor_info);
 }
 
-void Detector::Preprocess(const cv::Mat& input_image, cv::Mat& out_image,
-                          float& ratio_w, float& ratio_h) {
-  cv::Mat image;
-  cv::cvtColor(input_image, image, cv::COLOR_BGR2RGB);
+void Detector::Preprocess(const cv::Mat& input_image, float& ratio_w,
+                          float& ratio_h) {
+  cv::Mat image = input_image;
+  if (image.type() == CV_8UC1) {
+    cv::cvtColor(input_image, image, cv::COLOR_GRAY2BGR);
+  } else if (image.type() == CV_8UC4) {
+    cv::cvtColor(input_image, image, cv::COLOR_BGRA2BGR);
+  }
   int input_width = image.cols;
   int input_height = image.rows;
-  int param_w = 602;
-  int param_h = 378;
+  if (config_.fixed_shape) {
+    PreprocessLetterbox(image, ratio_w, ratio_h);
+    return;
+  }
+  pad_left_ = 0;
+  pad_top_ = 0;
+  int param_w = config_.target_width;
+  int param_h = config_.target_height;
 
-  int param_max_side_length = 1200;
+  int param_max_side_length = config_.max_side_length;
   float ratio = 1.0;
   if (std::max(input_height, input_width) > param_max_side_length) {
     ratio = float(param_max_side_length) / input_height;
@@ -135,9 +289,13 @@ void Detector::Preprocess(const cv::Mat& input_image, cv::Mat& out_image,
     new_w = int(new_w / 32) * 32;
   }
 
-  cv::Mat resize_image;
-  cv::resize(image, resize_image, cv::Size(new_w, new_h));
-  resize_image.convertTo(out_image, CV_32FC3);
+  // RGB float NHWC straight into the input tensor buffer
+  input_width_ = new_w;
+  input_height_ = new_h;
+  input_buffer_.resize(size_t(new_w) * new_h * 3);
+  ResizeBGRToRGBFloat(image.data, image.cols, image.rows, image.step,
+                      input_buffer_.data(), new_w, new_h, size_t(new_w) * 3,
+                      resize_buffers_);
   SPDLOG_INFO("image resize from [{} {}] -> [{} {}]", input_width, input_height,
               new_w, new_h);
 
@@ -145,182 +303,62 @@ void Detector::Preprocess(const cv::Mat& input_image, cv::Mat& out_image,
   ratio_h = new_h / float(input_height);
 }
 
-std::vector<float> RestoreRBox(float* geo_array, float* score_array, int height,
-                               int width) {
-  std::vector<float> quad_data;
-  for (int i = 0; i < height; i++) {
-    for (int j = 0; j < width; j++) {
-      int idx = i * width + j;
-      if (score_array[idx] > 0.8) {
-        int x = j * 4;
-        int y = i * 4;
-        float d0 = geo_array[i * width * 5 + j * 5 + 0];
-        float d1 = geo_array[i * width * 5 + j * 5 + 1];
-        float d2 = geo_array[i * width * 5 + j * 5 + 2];
-        float d3 = geo_array[i * width * 5 + j * 5 + 3];
-        float angle = geo_array[i * width * 5 + j * 5 + 4];
-        if (angle >= 0) {
-          float a0 = 0;
-          float a1 = -d0 - d2;
-          float a2 = d1 + d3;
-          float a3 = -d0 - d2;
-          float a4 = d1 + d3;
-          float a5 = 0;
-          float a6 = 0;
-          float a7 = 0;
-          float a8 = d3;
-          float a9 = -d2;
-
-          float rotate_x0 = std::cos(angle);
-          float rotate_x1 = std::sin(angle);
-
-          float rotate_y0 = -std::sin(angle);
-          float rotate_y1 = std::cos(angle);
-
-          float bx0 = rotate_x0 * a0 + rotate_x1 * a1;
-          float bx1 = rotate_x0 * a2 + rotate_x1 * a3;
-          float bx2 = rotate_x0 * a4 + rotate_x1 * a5;
-          float bx3 = rotate_x0 * a6 + rotate_x1 * a7;
-          float bx4 = rotate_x0 * a8 + rotate_x1 * a9;
-
-          float by0 = rotate_y0 * a0 + rotate_y1 * a1;
-          float by1 = rotate_y0 * a2 + rotate_y1 * a3;
-          float by2 = rotate_y0 * a4 + rotate_y1 * a5;
-          float by3 = rotate_y0 * a6 + rotate_y1 * a7;
-          float by4 = rotate_y0 * a8 + rotate_y1 * a9;
-
-          float org_x = x - bx4;
-          float org_y = y - by4;
-          float new_px0 = bx0 + org_x;
-          float new_py0 = by0 + org_y;
-          float new_px1 = bx1 + org_x;
-          float new_py1 = by1 + org_y;
-          float new_px2 = bx2 + org_x;
-          float new_py2 = by2 + org_y;
-          float new_px3 = bx3 + org_x;
-          float new_py3 = by3 + org_y;
-
-          quad_data.push_back(new_px0);
-          quad_data.push_back(new_py0);
-          quad_data.push_back(new_px1);
-          quad_data.push_back(new_py1);
-          quad_data.push_back(new_px2);
-          quad_data.push_back(new_py2);
-          quad_data.push_back(new_px3);
-          quad_data.push_back(new_py3);
-          quad_data.push_back(score_array[idx]);
-        } else {
-          float a0 = -d1 - d3;
-          float a1 = -d0 - d2;
-          float a2 = 0;
-          float a3 = -d0 - d2;
-          float a4 = 0;
-          float a5 = 0;
-          float a6 = -d1 - d3;
-          float a7 = 0;
-          float a8 = -d1;
-          float a9 = -d2;
-
-          float rotate_x0 = std::cos(-angle);
-          float rotate_x1 = -std::sin(-angle);
-
-          float rotate_y0 = std::sin(-angle);
-          float rotate_y1 = std::cos(-angle);
-
-          float bx0 = rotate_x0 * a0 + rotate_x1 * a1;
-          float bx1 = rotate_x0 * a2 + rotate_x1 * a3;
-          float bx2 = rotate_x0 * a4 + rotate_x1 * a5;
-          float bx3 = rotate_x0 * a6 + rotate_x1 * a7;
-          float bx4 = rotate_x0 * a8 + rotate_x1 * a9;
-
-          float by0 = rotate_y0 * a0 + rotate_y1 * a1;
-          float by1 = rotate_y0 * a2 + rotate_y1 * a3;
-          float by2 = rotate_y0 * a4 + rotate_y1 * a5;
-          float by3 = rotate_y0 * a6 + rotate_y1 * a7;
-          float by4 = rotate_y0 * a8 + rotate_y1 * a9;
-
-          float org_x = x - bx4;
-          float org_y = y - by4;
-          float new_px0 = bx0 + org_x;
-          float new_py0 = by0 + org_y;
-          float new_px1 = bx1 + org_x;
-          float new_py1 = by1 + org_y;
-          float new_px2 = bx2 + org_x;
-          float new_py2 = by2 + org_y;
-          float new_px3 = bx3 + org_x;
-          float new_py3 = by3 + org_y;
-
-          quad_data.push_back(new_px0);
-          quad_data.push_back(new_py0);
-          quad_data.push_back(new_px1);
-          quad_data.push_back(new_py1);
-          quad_data.push_back(new_px2);
-          quad_data.push_back(new_py2);
-          quad_data.push_back(new_px3);
-          quad_data.push_back(new_py3);
-          quad_data.push_back(score_array[idx]);
-        }
-      }
-    }
+// Zeroes the canvas outside the left/top/width/height image rectangle.
+static void ClearPadding(float* canvas, int canvas_w, int canvas_h, int left,
+                         int top, int width, int height) {
+  size_t row = size_t(canvas_w) * 3;
+  std::fill(canvas, canvas + top * row, 0.0f);
+  std::fill(canvas + (top + height) * row, canvas + canvas_h * row, 0.0f);
+  for (int y = top; y < top + height; y++) {
+    float* line = canvas + y * row;
+    std::fill(line, line + left * 3, 0.0f);
+    std::fill(line + (left + width) * 3, line + row, 0.0f);
   }
+}
 
-  return quad_data;
+void Detector::PreprocessLetterbox(const cv::Mat& image, float& ratio_w,
+                                   float& ratio_h) {
+  int canvas_w = config_.fixed_width;
+  int canvas_h = config_.fixed_height;
+  float ratio = std::min(float(canvas_w) / image.cols,
+                         float(canvas_h) / image.rows);
+  int new_w = std::min(canvas_w, std::max(1, int(image.cols * ratio)));
+  int new_h = std::min(canvas_h, std::max(1, int(image.rows * ratio)));
+  pad_left_ = (canvas_w - new_w) / 2;
+  pad_top_ = (canvas_h - new_h) / 2;
+
+  input_width_ = canvas_w;
+  input_height_ = canvas_h;
+  input_buffer_.resize(size_t(canvas_w) * canvas_h * 3);
+  float* canvas = input_buffer_.data();
+  ClearPadding(canvas, canvas_w, canvas_h, pad_left_, pad_top_, new_w, new_h);
+  ResizeBGRToRGBFloat(image.data, image.cols, image.rows, image.step,
+                      canvas + (size_t(pad_top_) * canvas_w + pad_left_) * 3,
+                      new_w, new_h, size_t(canvas_w) * 3, resize_buffers_);
+  SPDLOG_INFO("image letterbox [{} {}] -> [{} {}] in [{} {}]", image.cols,
+              image.rows, new_w, new_h, canvas_w, canvas_h);
+
+  ratio_w = new_w / float(image.cols);
+  ratio_h = new_h / float(image.rows);
 }
 
 void Detector::Predict(const cv::Mat& image,
                        std::vector<std::vector<cv::Point2f>>& textlines) {
-  cv::Mat out_image;
   float ratio_h;
   float ratio_w;
-  Preprocess(image, out_image, ratio_w, ratio_h);
+  Preprocess(image, ratio_w, ratio_h);
   SPDLOG_DEBUG("image h={} w={} resize h={} w={} ratio h={} ratio w = {}",
-               image.rows, image.cols, out_image.rows, out_image.cols, ratio_h,
+               image.rows, image.cols, input_height_, input_width_, ratio_h,
                ratio_w);
-  int image_width = out_image.cols;
-  int image_height = out_image.rows;
-  int image_channels = out_image.channels();
-
-  std::vector<int64_t> input_node_dims = {1, image_height, image_width,
-                                          image_channels};
-  size_t input_tensor_size = image_width * image_height * image_channels;
-
-  // create input tensor object from data values
-  OrtMemoryInfo* allocator_info;
-  ORT_ABORT_ON_ERROR(ort_api_->CreateCpuMemoryInfo(
-      OrtArenaAllocator, OrtMemTypeDefault, &allocator_info));
-  OrtValue* input_tensor = NULL;
-  ORT_ABORT_ON_ERROR(ort_api_->CreateTensorWithDataAsOrtValue(
-      allocator_info, out_image.data, input_tensor_size * sizeof(float),
-      input_node_dims.data(), 4, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT,
-      &input_tensor));
-  int is_tensor;
-  ORT_ABORT_ON_ERROR(ort_api_->IsTensor(input_tensor, &is_tensor));
-  assert(is_tensor);
-
-  OrtStatus* status;
-  // const char* input_names[] = {"input_images:0"};
-  // const char* output_names[] = {"feature_fusion/concat_3:0",
-  //                               "feature_fusion/Conv_7/Sigmoid:0"};
-  const char* input_names[] = {"input"};
-  const char* output_names[] = {"geo_map", "score_map"};
-
-  OrtValue* output_tensor[2];
-  output_tensor[0] = NULL;
-  output_tensor[1] = NULL;
+  std::vector<int64_t> input_node_dims = {1, input_height_, input_width_, 3};
+  ORT_ABORT_ON_ERROR(binding_.BindInput(input_buffer_.data(), input_node_dims));
   SPDLOG_INFO("East run begin");
-  ORT_ABORT_ON_ERROR(ort_api_->Run(this->session_, NULL, input_names,
-                                   (const OrtValue* const*)&input_tensor, 1,
-                                   output_names, 2, output_tensor));
+  ORT_ABORT_ON_ERROR(binding_.Run());
   SPDLOG_INFO("East run end");
-  OrtValue* geo_map = output_tensor[0];
-  OrtValue* score_map = output_tensor[1];
-
-  std::vector<int64_t> geo_shape;
-  float* geo_array;
-  GetTensorDataAndShape(geo_map, &geo_array, geo_shape);
-  std::vector<int64_t> score_shape;
-  float* score_array;
-  GetTensorDataAndShape(score_map, &score_array, score_shape);
+  const float* geo_array = binding_.output(0);
+  const float* score_array = binding_.output(1);
+  const std::vector<int64_t>& geo_shape = binding_.output_shape(0);
+  const std::vector<int64_t>& score_shape = binding_.output_shape(1);
 
   int batch = score_shape[0];
   int height = score_shape[1];
@@ -328,33 +366,53 @@ void Detector::Predict(const cv::Mat& image,
   int geo_count = geo_shape[3];
   int score_count = score_shape[3];
 
-  std::vector<float> quad_data =
-      RestoreRBox(geo_array, score_array, height, width);
+  const float min_score = MinScoreAbove(config_.score_threshold);
+  size_t count = SelectCandidates(score_array, height * width, min_score,
+                                  candidates_);
+  if (config_.min_blob_area > 1 ||
+      (config_.subsample_blob_area > 0 && config_.blob_subsample_step > 1)) {
+    count = FilterCandidateBlobs(
+        width, config_.min_blob_area, config_.subsample_blob_area,
+        config_.blob_subsample_step, candidates_.data(), count, blob_buffers_);
+    SPDLOG_DEBUG("score map candidates after blob filtering {}", count);
+  }
+  if (config_.max_candidates > 0 && count > size_t(config_.max_candidates)) {
+    int* first = candidates_.data();
+    int* cap = first + config_.max_candidates;
+    std::nth_element(first, cap, first + count,
+                     [score_array](int a, int b) {
+                       return score_array[a] > score_array[b];
+                     });
+    // LANMS merges neighbours, put the survivors back in row-major order
+    std::sort(first, cap);
+    SPDLOG_DEBUG("candidates capped {} -> {}", count, config_.max_candidates);
+    count = config_.max_candidates;
+  }
+  quad_data_.resize(count * 9);
+  float* quad_data = quad_data_.data();
+  RestoreRBox(geo_array, score_array, width, candidates_.data(), count,
+              quad_data);
 
-  for (int i = 0; i < quad_data.size() / 9; i++) {
+  for (size_t i = 0; i < count; i++) {
     for (int j = 0; j < 8; j++) {
-      quad_data[i * 9 + j] *= 10000.0f;
+      quad_data[i * 9 + j] *= config_.coordinate_scale;
     }
   }
   std::vector<lanms::Polygon> polys =
-      merge_quadrangle_n9(quad_data.data(), quad_data.size() / 9, 0.2f);
-  std::vector<std::vector<float>> boxes = polys2floats_new(polys);
+      merge_quadrangle_n9(quad_data, count, config_.nms_threshold);
+  std::vector<std::vector<float>> boxes =
+      polys2floats_new(polys, config_.coordinate_scale);
 
   for (int i = 0; i < boxes.size(); i++) {
     auto box = boxes[i];
     std::vector<cv::Point2f> line_item;
     for (int i = 0; i < 4; i++) {
       line_item.push_back(
-          cv::Point2f(box[2 * i + 0] / ratio_w, box[2 * i + 1] / ratio_h));
+          cv::Point2f((box[2 * i + 0] - pad_left_) / ratio_w,
+                      (box[2 * i + 1] - pad_top_) / ratio_h));
     }
     textlines.push_back(line_item);
   }
-
-  ort_api_->ReleaseValue(geo_map);
-  ort_api_->ReleaseValue(score_map);
-  ort_api_->ReleaseValue(input_tensor);
-  ort_api_->ReleaseMemoryInfo(allocator_info);
-  return;
 }
 
 cv::Mat Detector::ShowTextLines(
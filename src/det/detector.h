@@ -4,24 +4,75 @@
 
 #pragma once
 #include "common/common.h"
+#include "common/session_binding.h"
+#include "common/session_config.h"
+#include "det/resize_kernel.h"
+#include "det/score_blobs.h"
 #include <opencv2/opencv.hpp>
 #include <string>
 #include "onnxruntime_c_api.h"
 
+struct DetectorConfig {
+  // score map pixels above this are text candidates
+  double score_threshold = 0.8;
+  // IoU above which LANMS merges two boxes
+  float nms_threshold = 0.2f;
+  // Dynamic shape mode: images are first capped at max_side_length, then
+  // fit into target_width x target_height and rounded down to multiples of
+  // 32.
+  int max_side_length = 1200;
+  int target_width = 602;
+  int target_height = 378;
+  // Keeps only the highest scoring candidates when more pass the filters,
+  // bounding the LANMS time on noisy images. 0 keeps all.
+  int max_candidates = 0;
+  // Quads are scaled by this for LANMS, whose clipper IoU works on integer
+  // coordinates; larger keeps more precision.
+  float coordinate_scale = 10000.0f;
+  // Letterbox every image into one fixed_width x fixed_height canvas and pin
+  // the input dims of the model to it with free dimension overrides, so
+  // onnxruntime plans memory once and optimizes for a static shape. Without
+  // it the input follows the aspect ratio of every image. Sizes are rounded
+  // down to multiples of 32.
+  bool fixed_shape = false;
+  int fixed_width = 608;
+  int fixed_height = 384;
+  // Optionally group the candidate pixels of the score map into
+  // 8-connected blobs before their geometry is decoded. Blobs under
+  // min_blob_area pixels are noise and dropped; blobs of subsample_blob_area
+  // pixels or more decode only one pixel in blob_subsample_step, which LANMS
+  // merges to nearly the same box. Both are off by default: dropping and
+  // thinning pixels changes the boxes LANMS merges, so a value should be
+  // checked against the detection results of the model in use before it
+  // is turned on. 4, 64 and 2 are a starting point.
+  int min_blob_area = 0;
+  int subsample_blob_area = 0;
+  int blob_subsample_step = 0;
+};
+
 class TUYUIDCARD_API Detector {
  public:
-  Detector(const OrtApi* ort_api, OrtEnv* env)
+  Detector(const OrtApi* ort_api, OrtEnv* env,
+           const DetectorConfig& config = DetectorConfig())
       : ort_api_(ort_api),
         env_(env),
+        config_(config),
         session_options_(nullptr),
-        session_(nullptr) {}
+        session_(nullptr),
+        input_width_(0),
+        input_height_(0),
+        pad_left_(0),
+        pad_top_(0) {}
   ~Detector();
 
   void GetInputs();
   void GetOutputs();
-  void Preprocess(const cv::Mat& image, cv::Mat& out, float& ratio_w,
-                  float& ratio_h);
-  void InitModel(const std::string& onnx_model_name);
+  // Resizes the image into the input tensor buffer of the detector, at
+  // pad_left_/pad_top_ of the canvas in fixed shape mode.
+  void Preprocess(const cv::Mat& image, float& ratio_w, float& ratio_h);
+  // Returns false when the model can not be loaded, the error is printed.
+  bool InitModel(const std::string& onnx_model_name,
+                 const SessionConfig& config = SessionConfig());
   void Predict(const cv::Mat& image,
                std::vector<std::vector<cv::Point2f>>& bboxes);
   void GetTensorDataAndShape(OrtValue* input_map, float** array,
@@ -31,11 +82,44 @@ class TUYUIDCARD_API Detector {
                         std::vector<std::vector<cv::Point2f>>& bboxes);
 
  private:
+  // Adds overrides for the symbolic input dims, which must be set before
+  // the session is created. With a model cache the dims are kept in a
+  // .dims file next to the optimized model; only without one, or on the
+  // first start, they are read from a probe session.
+  OrtStatus* LoadModel(const std::string& model_path,
+                       const SessionConfig& config);
+  OrtStatus* PinInputShape(const std::string& model_path,
+                           SessionConfig& config);
+  OrtStatus* ProbeInputDims(const std::string& model_path,
+                            std::vector<int64_t>& dims,
+                            std::vector<std::string>& names);
+  // Fixed shape mode of Preprocess: fits the image into the canvas, centered,
+  // with zero padding around it.
+  void PreprocessLetterbox(const cv::Mat& image, float& ratio_w,
+                           float& ratio_h);
+
   const OrtApi* ort_api_;
   OrtEnv* env_;
+  DetectorConfig config_;
   OrtSessionOptions* session_options_;
   OrtSession* session_;
+  // input_buffer_ bound as "input", geo_map/score_map kept between runs
+  SessionBinding binding_;
 
   std::vector<const char*> input_node_names_;
   std::vector<int64_t> input_node_dims_;
+
+  // RGB float input of the model, input_height_ x input_width_ x 3
+  std::vector<float> input_buffer_;
+  int input_width_;
+  int input_height_;
+  // offset of the image in the letterbox canvas
+  int pad_left_;
+  int pad_top_;
+  ResizeBuffers resize_buffers_;
+
+  // post-processing buffers reused across Predict calls
+  std::vector<int> candidates_;
+  BlobBuffers blob_buffers_;
+  std::vector<float> quad_data_;
 };
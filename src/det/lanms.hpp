@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
 #include <numeric>
 #include "det/clipper/clipper.hpp"
 
@@ -19,7 +22,10 @@ float paths_area(const ClipperLib::Paths &ps) {
   return area;
 }
 
-float poly_iou(const Polygon &a, const Polygon &b) {
+/**
+ * Reference IoU through Clipper, handles any simple polygon.
+ */
+float poly_iou_clipper(const Polygon &a, const Polygon &b) {
   cl::Clipper clpr;
   clpr.AddPath(a.poly, cl::ptSubject, true);
   clpr.AddPath(b.poly, cl::ptClip, true);
@@ -32,6 +38,108 @@ float poly_iou(const Polygon &a, const Polygon &b) {
   return std::abs(inter_area) / std::max(std::abs(uni_area), 1.0f);
 }
 
+double signed_area(const double *xs, const double *ys, int n) {
+  double area = 0;
+  for (int i = 0, j = n - 1; i < n; j = i++) {
+    area += xs[j] * ys[i] - xs[i] * ys[j];
+  }
+  return area * 0.5;
+}
+
+/**
+ * Whether a quadrangle is convex: every turn goes the same way. A bowtie
+ * or a quad with a reflex corner turns both ways.
+ */
+bool is_convex_quad(const cl::Path &q) {
+  bool has_left = false, has_right = false;
+  for (int i = 0; i < 4; i++) {
+    const cl::IntPoint &p0 = q[i], &p1 = q[(i + 1) % 4], &p2 = q[(i + 2) % 4];
+    double cross = double(p1.X - p0.X) * double(p2.Y - p1.Y) -
+                   double(p1.Y - p0.Y) * double(p2.X - p1.X);
+    if (cross > 0) has_left = true;
+    if (cross < 0) has_right = true;
+  }
+  return !(has_left && has_right);
+}
+
+/**
+ * Intersection area of two convex quadrangles by Sutherland-Hodgman
+ * clipping of a against every edge of b. Works on fixed size stack arrays:
+ * each of the 4 clip edges adds at most one vertex, so 8 is enough. Returns
+ * -1 if the output would not fit, which only happens for non-convex input.
+ */
+double convex_quad_inter_area(const cl::Path &a, const cl::Path &b) {
+  const int kMaxVertices = 8;
+  double cx[4], cy[4];
+  for (int i = 0; i < 4; i++) {
+    cx[i] = double(b[i].X);
+    cy[i] = double(b[i].Y);
+  }
+  double clip_area = signed_area(cx, cy, 4);
+  if (clip_area == 0) return 0;
+  // make the clip polygon counter-clockwise so inside is on the left
+  if (clip_area < 0) {
+    std::swap(cx[1], cx[3]);
+    std::swap(cy[1], cy[3]);
+  }
+
+  double xs[2][kMaxVertices], ys[2][kMaxVertices];
+  int n = 4, cur = 0;
+  for (int i = 0; i < 4; i++) {
+    xs[cur][i] = double(a[i].X);
+    ys[cur][i] = double(a[i].Y);
+  }
+
+  for (int e = 0; e < 4 && n > 0; e++) {
+    double ex0 = cx[e], ey0 = cy[e];
+    double dx = cx[(e + 1) % 4] - ex0, dy = cy[(e + 1) % 4] - ey0;
+    const double *sx = xs[cur], *sy = ys[cur];
+    double *ox = xs[1 - cur], *oy = ys[1 - cur];
+    int m = 0;
+    double prev_side = dx * (sy[n - 1] - ey0) - dy * (sx[n - 1] - ex0);
+    for (int k = 0, p = n - 1; k < n; p = k++) {
+      double side = dx * (sy[k] - ey0) - dy * (sx[k] - ex0);
+      if ((side >= 0) != (prev_side >= 0)) {
+        if (m == kMaxVertices) return -1;
+        double t = prev_side / (prev_side - side);
+        ox[m] = sx[p] + t * (sx[k] - sx[p]);
+        oy[m] = sy[p] + t * (sy[k] - sy[p]);
+        m++;
+      }
+      if (side >= 0) {
+        if (m == kMaxVertices) return -1;
+        ox[m] = sx[k];
+        oy[m] = sy[k];
+        m++;
+      }
+      prev_side = side;
+    }
+    n = m;
+    cur = 1 - cur;
+  }
+  if (n < 3) return 0;
+  return std::abs(signed_area(xs[cur], ys[cur], n));
+}
+
+float poly_iou(const Polygon &a, const Polygon &b) {
+#ifdef LANMS_CLIPPER_IOU
+  return poly_iou_clipper(a, b);
+#else
+  // merged polygons are weighted averages of detections and may come out
+  // non-convex or self-intersecting, Sutherland-Hodgman needs convex quads
+  if (a.poly.size() != 4 || b.poly.size() != 4 || !is_convex_quad(a.poly) ||
+      !is_convex_quad(b.poly)) {
+    return poly_iou_clipper(a, b);
+  }
+  // union of two convex polygons is areaA + areaB - inter
+  double inter_area = convex_quad_inter_area(a.poly, b.poly);
+  if (inter_area < 0) return poly_iou_clipper(a, b);
+  double uni_area = std::abs(cl::Area(a.poly)) + std::abs(cl::Area(b.poly)) -
+                    inter_area;
+  return float(inter_area / std::max(uni_area, 1.0));
+#endif
+}
+
 bool should_merge(const Polygon &a, const Polygon &b, float iou_threshold) {
   return poly_iou(a, b) > iou_threshold;
 }
@@ -153,6 +261,95 @@ class PolyMerger {
   std::int32_t nr_polys;
 };
 
+/**
+ * Axis aligned bounding box of a polygon.
+ */
+struct BBox {
+  cl::cInt x0, y0, x1, y1;
+};
+
+BBox poly_bbox(const Polygon &p) {
+  BBox box{p.poly[0].X, p.poly[0].Y, p.poly[0].X, p.poly[0].Y};
+  for (auto &&pt : p.poly) {
+    box.x0 = std::min(box.x0, pt.X);
+    box.y0 = std::min(box.y0, pt.Y);
+    box.x1 = std::max(box.x1, pt.X);
+    box.y1 = std::max(box.y1, pt.Y);
+  }
+  return box;
+}
+
+/**
+ * Uniform grid over polygon bounding boxes. Every polygon is registered in
+ * all cells its box covers, cells are stored as one flat array.
+ */
+class BBoxGrid {
+ public:
+  explicit BBoxGrid(const std::vector<BBox> &boxes) {
+    size_t n = boxes.size();
+    double mean_w = 0, mean_h = 0;
+    x0_ = boxes[0].x0, y0_ = boxes[0].y0;
+    cl::cInt x1 = boxes[0].x1, y1 = boxes[0].y1;
+    for (auto &&b : boxes) {
+      x0_ = std::min(x0_, b.x0);
+      y0_ = std::min(y0_, b.y0);
+      x1 = std::max(x1, b.x1);
+      y1 = std::max(y1, b.y1);
+      mean_w += double(b.x1 - b.x0) / n;
+      mean_h += double(b.y1 - b.y0) / n;
+    }
+    // about one box per cell, at most 256 cells per side
+    double extent_w = double(x1 - x0_) + 1, extent_h = double(y1 - y0_) + 1;
+    cell_w_ = std::max({mean_w, extent_w / 256, 1.0});
+    cell_h_ = std::max({mean_h, extent_h / 256, 1.0});
+    cols_ = int(extent_w / cell_w_) + 1;
+    rows_ = int(extent_h / cell_h_) + 1;
+
+    start_.assign(size_t(cols_) * rows_ + 1, 0);
+    for (auto &&b : boxes) {
+      for_cells(b, [&](size_t cell) { start_[cell + 1]++; });
+    }
+    for (size_t c = 1; c < start_.size(); c++) start_[c] += start_[c - 1];
+    items_.resize(start_.back());
+    std::vector<size_t> fill(start_.begin(), start_.end() - 1);
+    for (size_t i = 0; i < n; i++) {
+      for_cells(boxes[i], [&](size_t cell) { items_[fill[cell]++] = i; });
+    }
+  }
+
+  /**
+   * Calls f(cell) for every cell the box covers.
+   */
+  template <typename F>
+  void for_cells(const BBox &b, F f) const {
+    int c0 = col(b.x0), c1 = col(b.x1), r0 = row(b.y0), r1 = row(b.y1);
+    for (int r = r0; r <= r1; r++) {
+      for (int c = c0; c <= c1; c++) f(size_t(r) * cols_ + c);
+    }
+  }
+
+  const size_t *cell_begin(size_t cell) const {
+    return items_.data() + start_[cell];
+  }
+  const size_t *cell_end(size_t cell) const {
+    return items_.data() + start_[cell + 1];
+  }
+
+ private:
+  int col(cl::cInt x) const {
+    return std::min(cols_ - 1, std::max(0, int((x - x0_) / cell_w_)));
+  }
+  int row(cl::cInt y) const {
+    return std::min(rows_ - 1, std::max(0, int((y - y0_) / cell_h_)));
+  }
+
+  cl::cInt x0_, y0_;
+  double cell_w_, cell_h_;
+  int cols_, rows_;
+  std::vector<size_t> start_;
+  std::vector<size_t> items_;
+};
+
 /**
  * The standard NMS algorithm.
  */
@@ -167,15 +364,50 @@ std::vector<Polygon> standard_nms(std::vector<Polygon> &polys,
   });
 
   std::vector<size_t> keep;
-  while (indices.size()) {
-    size_t p = 0, cur = indices[0];
-    keep.emplace_back(cur);
-    for (size_t i = 1; i < indices.size(); i++) {
-      if (!should_merge(polys[cur], polys[indices[i]], iou_threshold)) {
-        indices[p++] = indices[i];
+  // Polygons whose boxes do not overlap have IoU 0 and never merge, so
+  // with a non-negative threshold only the grid neighbours of the current
+  // polygon need an exact check. Small inputs skip building the grid.
+  if (n < 16 || iou_threshold < 0) {
+    while (indices.size()) {
+      size_t p = 0, cur = indices[0];
+      keep.emplace_back(cur);
+      for (size_t i = 1; i < indices.size(); i++) {
+        if (!should_merge(polys[cur], polys[indices[i]], iou_threshold)) {
+          indices[p++] = indices[i];
+        }
       }
+      indices.resize(p);
+    }
+  } else {
+    std::vector<BBox> boxes(n);
+    for (size_t i = 0; i < n; i++) boxes[i] = poly_bbox(polys[i]);
+    BBoxGrid grid(boxes);
+
+    std::vector<size_t> rank(n), visited(n, n);
+    for (size_t k = 0; k < n; k++) rank[indices[k]] = k;
+    std::vector<char> suppressed(n, 0);
+    for (size_t k = 0; k < n; k++) {
+      size_t cur = indices[k];
+      if (suppressed[cur]) continue;
+      keep.emplace_back(cur);
+      const BBox &b = boxes[cur];
+      grid.for_cells(b, [&](size_t cell) {
+        for (auto it = grid.cell_begin(cell); it != grid.cell_end(cell);
+             ++it) {
+          size_t i = *it;
+          // only lower ranked polygons still alive, each one checked once
+          if (rank[i] <= k || suppressed[i] || visited[i] == k) continue;
+          visited[i] = k;
+          const BBox &o = boxes[i];
+          if (o.x0 > b.x1 || o.x1 < b.x0 || o.y0 > b.y1 || o.y1 < b.y0) {
+            continue;
+          }
+          if (should_merge(polys[cur], polys[i], iou_threshold)) {
+            suppressed[i] = 1;
+          }
+        }
+      });
     }
-    indices.resize(p);
   }
 
   std::vector<Polygon> ret;
@@ -243,21 +475,22 @@ std::vector<std::vector<float>> polys2floats(
   return ret;
 }
 
+// Undoes the coordinate scale applied before merge_quadrangle_n9.
 std::vector<std::vector<float>> polys2floats_new(
-    std::vector<lanms::Polygon> &polys) {
+    std::vector<lanms::Polygon> &polys, double scale = 10000.0) {
   std::vector<std::vector<float>> ret;
   for (size_t i = 0; i < polys.size(); i++) {
     auto &p = polys[i];
     auto &poly = p.poly;
     ret.emplace_back(std::vector<float>{
-        float(static_cast<double>(poly[0].X) / 10000.0),
-        float(static_cast<double>(poly[0].Y) / 10000.0),
-        float(static_cast<double>(poly[1].X) / 10000.0),
-        float(static_cast<double>(poly[1].Y) / 10000.0),
-        float(static_cast<double>(poly[2].X) / 10000.0),
-        float(static_cast<double>(poly[2].Y) / 10000.0),
-        float(static_cast<double>(poly[3].X) / 10000.0),
-        float(static_cast<double>(poly[3].Y) / 10000.0),
+        float(static_cast<double>(poly[0].X) / scale),
+        float(static_cast<double>(poly[0].Y) / scale),
+        float(static_cast<double>(poly[1].X) / scale),
+        float(static_cast<double>(poly[1].Y) / scale),
+        float(static_cast<double>(poly[2].X) / scale),
+        float(static_cast<double>(poly[2].Y) / scale),
+        float(static_cast<double>(poly[3].X) / scale),
+        float(static_cast<double>(poly[3].Y) / scale),
         float(p.score),
     });
   }
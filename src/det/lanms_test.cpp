@@ -0,0 +1,151 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+// Compares the convex quad IoU of LANMS with the Clipper reference on random
+// quads, convex or not, in both orientations.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "common/test_check.h"
+#include "det/lanms.hpp"
+
+// Quads are in the detector's scaled integer coordinates, so Clipper's
+// rounding of intersection vertices stays far below the tolerance.
+static const double kCoordScale = 10000.0;
+static const double kTolerance = 1e-4;
+
+static lanms::Polygon MakeQuad(const double* xs, const double* ys) {
+  lanms::Polygon polygon;
+  for (int i = 0; i < 4; i++) {
+    polygon.poly.push_back(ClipperLib::IntPoint(
+        ClipperLib::cInt(std::lround(xs[i] * kCoordScale)),
+        ClipperLib::cInt(std::lround(ys[i] * kCoordScale))));
+  }
+  polygon.score = 1.0f;
+  return polygon;
+}
+
+// A rotated rectangle like the ones RestoreRBox emits, clockwise or not.
+static lanms::Polygon RandomBox(std::mt19937& rng) {
+  std::uniform_real_distribution<double> center(20.0, 40.0);
+  std::uniform_real_distribution<double> size(2.0, 30.0);
+  std::uniform_real_distribution<double> angle(-0.8, 0.8);
+  double cx = center(rng), cy = center(rng);
+  double w = size(rng), h = size(rng) / 3;
+  double a = angle(rng);
+  double c = std::cos(a), s = std::sin(a);
+  double dx[4] = {-w, w, w, -w}, dy[4] = {-h, -h, h, h};
+  bool flip = rng() & 1;
+  double xs[4], ys[4];
+  for (int i = 0; i < 4; i++) {
+    int k = flip ? 3 - i : i;
+    xs[i] = cx + (dx[k] * c - dy[k] * s) / 2;
+    ys[i] = cy + (dx[k] * s + dy[k] * c) / 2;
+  }
+  return MakeQuad(xs, ys);
+}
+
+// Four random points around a center: convex, reflex or self-intersecting.
+static lanms::Polygon RandomQuad(std::mt19937& rng, bool sorted) {
+  std::uniform_real_distribution<double> center(20.0, 40.0);
+  std::uniform_real_distribution<double> radius(1.0, 20.0);
+  std::uniform_real_distribution<double> angle(0.0, 6.283185307179586);
+  double cx = center(rng), cy = center(rng);
+  double angles[4];
+  for (double& a : angles) a = angle(rng);
+  if (sorted) std::sort(angles, angles + 4);
+  double xs[4], ys[4];
+  for (int i = 0; i < 4; i++) {
+    double r = radius(rng);
+    xs[i] = cx + r * std::cos(angles[i]);
+    ys[i] = cy + r * std::sin(angles[i]);
+  }
+  return MakeQuad(xs, ys);
+}
+
+static void ExpectIouMatches(const lanms::Polygon& a, const lanms::Polygon& b,
+                             const char* what) {
+  float iou = lanms::poly_iou(a, b);
+  float reference = lanms::poly_iou_clipper(a, b);
+  EXPECT(std::fabs(iou - reference) <= kTolerance, "%s: %g, clipper %g", what,
+         iou, reference);
+}
+
+static void TestRandomQuads() {
+  std::mt19937 rng(19);
+  int convex_pairs = 0;
+  for (int trial = 0; trial < 20000; trial++) {
+    lanms::Polygon a, b;
+    if (trial % 2 == 0) {
+      a = RandomBox(rng);
+      b = RandomBox(rng);
+    } else {
+      // sorted angles give convex quads, unsorted ones mostly do not
+      a = RandomQuad(rng, trial % 4 == 1);
+      b = RandomQuad(rng, trial % 4 == 1);
+    }
+    if (lanms::is_convex_quad(a.poly) && lanms::is_convex_quad(b.poly)) {
+      convex_pairs++;
+      // the intersection area alone, before the union division
+      ClipperLib::Clipper clipper;
+      clipper.AddPath(a.poly, ClipperLib::ptSubject, true);
+      clipper.AddPath(b.poly, ClipperLib::ptClip, true);
+      ClipperLib::Paths inter;
+      clipper.Execute(ClipperLib::ctIntersection, inter,
+                      ClipperLib::pftEvenOdd);
+      double reference = 0;
+      for (const ClipperLib::Path& path : inter) {
+        reference += ClipperLib::Area(path);
+      }
+      double area = lanms::convex_quad_inter_area(a.poly, b.poly);
+      double scale = std::max(std::fabs(ClipperLib::Area(a.poly)), 1.0);
+      EXPECT(std::fabs(area - std::fabs(reference)) <= kTolerance * scale,
+             "intersection %g, clipper %g", area, reference);
+    }
+    ExpectIouMatches(a, b, "random pair");
+  }
+  EXPECT(convex_pairs > 5000, "only %d convex pairs", convex_pairs);
+}
+
+static void TestSpecialCases() {
+  double xs[4] = {0, 10, 10, 0}, ys[4] = {0, 0, 5, 5};
+  lanms::Polygon box = MakeQuad(xs, ys);
+  EXPECT(std::fabs(lanms::poly_iou(box, box) - 1.0f) <= kTolerance,
+         "identical quads, iou %g", lanms::poly_iou(box, box));
+
+  double far_xs[4] = {20, 30, 30, 20};
+  lanms::Polygon far_box = MakeQuad(far_xs, ys);
+  EXPECT(lanms::poly_iou(box, far_box) == 0.0f, "disjoint quads");
+
+  // sharing an edge overlaps in no area
+  double touch_xs[4] = {10, 20, 20, 10};
+  lanms::Polygon touching = MakeQuad(touch_xs, ys);
+  EXPECT(lanms::poly_iou(box, touching) == 0.0f, "touching quads, iou %g",
+         lanms::poly_iou(box, touching));
+  ExpectIouMatches(box, touching, "touching quads");
+
+  // one inside the other
+  double in_xs[4] = {2, 4, 4, 2}, in_ys[4] = {1, 1, 3, 3};
+  lanms::Polygon inner = MakeQuad(in_xs, in_ys);
+  ExpectIouMatches(box, inner, "nested quads");
+  EXPECT(std::fabs(lanms::poly_iou(box, inner) - 4.0f / 50.0f) <= kTolerance,
+         "nested quads, iou %g", lanms::poly_iou(box, inner));
+
+  // bowtie and reflex corner take the Clipper path
+  double bow_xs[4] = {0, 10, 0, 10};
+  lanms::Polygon bowtie = MakeQuad(bow_xs, ys);
+  EXPECT(!lanms::is_convex_quad(bowtie.poly), "a bowtie is not convex");
+  ExpectIouMatches(box, bowtie, "bowtie");
+  double dart_xs[4] = {0, 10, 3, 0}, dart_ys[4] = {0, 0, 2, 5};
+  lanms::Polygon dart = MakeQuad(dart_xs, dart_ys);
+  EXPECT(!lanms::is_convex_quad(dart.poly), "a dart is not convex");
+  ExpectIouMatches(box, dart, "dart");
+}
+
+int main() {
+  TestRandomQuads();
+  TestSpecialCases();
+  return TestResult();
+}
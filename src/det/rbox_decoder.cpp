@@ -0,0 +1,253 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "rbox_decoder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RBOX_USE_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define RBOX_USE_NEON
+#endif
+
+float MinScoreAbove(double threshold) {
+  float min_score = static_cast<float>(threshold);
+  if (static_cast<double>(min_score) <= threshold) {
+    min_score =
+        std::nextafter(min_score, std::numeric_limits<float>::infinity());
+  }
+  return min_score;
+}
+
+size_t SelectCandidates(const float* score_array, int size, float min_score,
+                        std::vector<int>& candidates) {
+  if (candidates.size() < size_t(size)) {
+    candidates.resize(size);
+  }
+  int* out = candidates.data();
+  size_t count = 0;
+  int i = 0;
+#if defined(RBOX_USE_SSE2)
+  const __m128 threshold = _mm_set1_ps(min_score);
+  for (; i + 8 <= size; i += 8) {
+    int mask = _mm_movemask_ps(
+                   _mm_cmpge_ps(_mm_loadu_ps(score_array + i), threshold)) |
+               (_mm_movemask_ps(_mm_cmpge_ps(
+                    _mm_loadu_ps(score_array + i + 4), threshold))
+                << 4);
+    // most of the map is background, skip whole blocks
+    while (mask != 0) {
+      int bit = 0;
+      while (((mask >> bit) & 1) == 0) bit++;
+      out[count++] = i + bit;
+      mask &= mask - 1;
+    }
+  }
+#elif defined(RBOX_USE_NEON)
+  const float32x4_t threshold = vdupq_n_f32(min_score);
+  for (; i + 4 <= size; i += 4) {
+    uint32x4_t mask = vcgeq_f32(vld1q_f32(score_array + i), threshold);
+    if (vmaxvq_u32(mask) == 0) continue;
+    for (int k = 0; k < 4; k++) {
+      if (score_array[i + k] >= min_score) out[count++] = i + k;
+    }
+  }
+#endif
+  for (; i < size; i++) {
+    if (score_array[i] >= min_score) out[count++] = i;
+  }
+  return count;
+}
+
+// sin and cos as in Cephes sinf/cosf: reduce the angle by multiples of pi/4
+// to [-pi/4, pi/4], where both are short minimax polynomials, and pick and
+// sign them by octant. Absolute error below 1e-7 for |angle| < 8192.
+static const float kFourOverPi = 1.27323954f;
+static const float kPiOver4Part1 = 0.78515625f;
+static const float kPiOver4Part2 = 2.4187564849853515625e-4f;
+static const float kPiOver4Part3 = 3.77489497744594108e-8f;
+static const float kCosPoly[3] = {2.443315711809948e-5f, -1.388731625493765e-3f,
+                                  4.166664568298827e-2f};
+static const float kSinPoly[3] = {-1.9515295891e-4f, 8.3321608736e-3f,
+                                  -1.6666654611e-1f};
+
+static void SinCosScalar(const float* angles, size_t n, float* sin_values,
+                         float* cos_values) {
+  for (size_t k = 0; k < n; k++) {
+    float x = std::fabs(angles[k]);
+    int j = (int(x * kFourOverPi) + 1) & ~1;
+    float y = float(j);
+    x = ((x - y * kPiOver4Part1) - y * kPiOver4Part2) - y * kPiOver4Part3;
+    float z = x * x;
+    float pc = ((kCosPoly[0] * z + kCosPoly[1]) * z + kCosPoly[2]) * z * z -
+               0.5f * z + 1.0f;
+    float ps = ((kSinPoly[0] * z + kSinPoly[1]) * z + kSinPoly[2]) * z * x + x;
+    float s = (j & 2) ? pc : ps;
+    float c = (j & 2) ? ps : pc;
+    if (j & 4) s = -s;
+    if ((j + 2) & 4) c = -c;
+    sin_values[k] = angles[k] < 0 ? -s : s;
+    cos_values[k] = c;
+  }
+}
+
+#if defined(RBOX_USE_SSE2)
+static void SinCos(const float* angles, size_t n, float* sin_values,
+                   float* cos_values) {
+  const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(INT32_MIN));
+  size_t k = 0;
+  for (; k + 4 <= n; k += 4) {
+    __m128 angle = _mm_loadu_ps(angles + k);
+    __m128 sign = _mm_and_ps(angle, sign_mask);
+    __m128 x = _mm_andnot_ps(sign_mask, angle);
+    __m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(kFourOverPi)));
+    j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+    __m128 y = _mm_cvtepi32_ps(j);
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(kPiOver4Part1)));
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(kPiOver4Part2)));
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(kPiOver4Part3)));
+    __m128 z = _mm_mul_ps(x, x);
+
+    __m128 pc = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kCosPoly[0]), z),
+                           _mm_set1_ps(kCosPoly[1]));
+    pc = _mm_add_ps(_mm_mul_ps(pc, z), _mm_set1_ps(kCosPoly[2]));
+    pc = _mm_mul_ps(_mm_mul_ps(pc, z), z);
+    pc = _mm_sub_ps(pc, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+    pc = _mm_add_ps(pc, _mm_set1_ps(1.0f));
+    __m128 ps = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kSinPoly[0]), z),
+                           _mm_set1_ps(kSinPoly[1]));
+    ps = _mm_add_ps(_mm_mul_ps(ps, z), _mm_set1_ps(kSinPoly[2]));
+    ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, z), x), x);
+
+    __m128 swap = _mm_castsi128_ps(
+        _mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)),
+                        _mm_set1_epi32(2)));
+    __m128 s = _mm_or_ps(_mm_and_ps(swap, pc), _mm_andnot_ps(swap, ps));
+    __m128 c = _mm_or_ps(_mm_and_ps(swap, ps), _mm_andnot_ps(swap, pc));
+    __m128 sin_sign = _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+    __m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(
+        _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(2)),
+                      _mm_set1_epi32(4)),
+        29));
+    _mm_storeu_ps(sin_values + k, _mm_xor_ps(s, _mm_xor_ps(sin_sign, sign)));
+    _mm_storeu_ps(cos_values + k, _mm_xor_ps(c, cos_sign));
+  }
+  SinCosScalar(angles + k, n - k, sin_values + k, cos_values + k);
+}
+#elif defined(RBOX_USE_NEON)
+static void SinCos(const float* angles, size_t n, float* sin_values,
+                   float* cos_values) {
+  const uint32x4_t sign_mask = vdupq_n_u32(0x80000000u);
+  size_t k = 0;
+  for (; k + 4 <= n; k += 4) {
+    float32x4_t angle = vld1q_f32(angles + k);
+    uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(angle), sign_mask);
+    float32x4_t x = vabsq_f32(angle);
+    int32x4_t j = vcvtq_s32_f32(vmulq_n_f32(x, kFourOverPi));
+    j = vandq_s32(vaddq_s32(j, vdupq_n_s32(1)), vdupq_n_s32(~1));
+    float32x4_t y = vcvtq_f32_s32(j);
+    x = vmlsq_n_f32(x, y, kPiOver4Part1);
+    x = vmlsq_n_f32(x, y, kPiOver4Part2);
+    x = vmlsq_n_f32(x, y, kPiOver4Part3);
+    float32x4_t z = vmulq_f32(x, x);
+
+    float32x4_t pc = vmlaq_n_f32(vdupq_n_f32(kCosPoly[1]), z, kCosPoly[0]);
+    pc = vmlaq_f32(vdupq_n_f32(kCosPoly[2]), pc, z);
+    pc = vmulq_f32(vmulq_f32(pc, z), z);
+    pc = vmlsq_n_f32(pc, z, 0.5f);
+    pc = vaddq_f32(pc, vdupq_n_f32(1.0f));
+    float32x4_t ps = vmlaq_n_f32(vdupq_n_f32(kSinPoly[1]), z, kSinPoly[0]);
+    ps = vmlaq_f32(vdupq_n_f32(kSinPoly[2]), ps, z);
+    ps = vmlaq_f32(x, vmulq_f32(ps, z), x);
+
+    uint32x4_t swap = vtstq_s32(j, vdupq_n_s32(2));
+    float32x4_t s = vbslq_f32(swap, pc, ps);
+    float32x4_t c = vbslq_f32(swap, ps, pc);
+    uint32x4_t sin_sign = vshlq_n_u32(
+        vreinterpretq_u32_s32(vandq_s32(j, vdupq_n_s32(4))), 29);
+    uint32x4_t cos_sign = vshlq_n_u32(
+        vreinterpretq_u32_s32(
+            vandq_s32(vaddq_s32(j, vdupq_n_s32(2)), vdupq_n_s32(4))),
+        29);
+    vst1q_f32(sin_values + k,
+              vreinterpretq_f32_u32(veorq_u32(
+                  vreinterpretq_u32_f32(s), veorq_u32(sin_sign, sign))));
+    vst1q_f32(cos_values + k, vreinterpretq_f32_u32(veorq_u32(
+                                  vreinterpretq_u32_f32(c), cos_sign)));
+  }
+  SinCosScalar(angles + k, n - k, sin_values + k, cos_values + k);
+}
+#else
+static void SinCos(const float* angles, size_t n, float* sin_values,
+                   float* cos_values) {
+  SinCosScalar(angles, n, sin_values, cos_values);
+}
+#endif
+
+void RestoreRBox(const float* geo_array, const float* score_array, int width,
+                 const int* candidates, size_t count, float* quad_data) {
+  // The angles of a block of candidates are gathered and their sin/cos
+  // computed vectorized, then a branch free rotation loop runs over the
+  // block. Both signs of the angle share one rotation since cos(-a) =
+  // cos(a) and -sin(-a) = sin(a); only the box offsets differ.
+  const size_t kBlock = 64;
+  float angles[kBlock];
+  float cos_values[kBlock];
+  float sin_values[kBlock];
+  for (size_t begin = 0; begin < count; begin += kBlock) {
+    size_t n = std::min(kBlock, count - begin);
+    const int* idx = candidates + begin;
+    for (size_t k = 0; k < n; k++) {
+      angles[k] = geo_array[idx[k] * 5 + 4];
+    }
+    SinCos(angles, n, sin_values, cos_values);
+
+    float* out = quad_data + begin * 9;
+    for (size_t k = 0; k < n; k++, out += 9) {
+      const float* geo = geo_array + idx[k] * 5;
+      float d0 = geo[0];
+      float d1 = geo[1];
+      float d2 = geo[2];
+      float d3 = geo[3];
+      float h = -d0 - d2;
+      float w = d1 + d3;
+      float a[10];
+      if (geo[4] >= 0) {
+        a[0] = 0, a[1] = h, a[2] = w, a[3] = h, a[4] = w;
+        a[5] = 0, a[6] = 0, a[7] = 0, a[8] = d3, a[9] = -d2;
+      } else {
+        a[0] = -w, a[1] = h, a[2] = 0, a[3] = h, a[4] = 0;
+        a[5] = 0, a[6] = -w, a[7] = 0, a[8] = -d1, a[9] = -d2;
+      }
+
+      float rotate_x0 = cos_values[k];
+      float rotate_x1 = sin_values[k];
+      float rotate_y0 = -sin_values[k];
+      float rotate_y1 = cos_values[k];
+      float bx[5];
+      float by[5];
+      for (int p = 0; p < 5; p++) {
+        bx[p] = rotate_x0 * a[2 * p] + rotate_x1 * a[2 * p + 1];
+        by[p] = rotate_y0 * a[2 * p] + rotate_y1 * a[2 * p + 1];
+      }
+
+      float x = (idx[k] % width) * 4;
+      float y = (idx[k] / width) * 4;
+      float org_x = x - bx[4];
+      float org_y = y - by[4];
+      for (int p = 0; p < 4; p++) {
+        out[2 * p] = bx[p] + org_x;
+        out[2 * p + 1] = by[p] + org_y;
+      }
+      out[8] = score_array[idx[k]];
+    }
+  }
+}
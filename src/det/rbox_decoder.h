@@ -0,0 +1,23 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Smallest float s with s > threshold, so that `score >= s` selects exactly
+// the pixels the double comparison `score > threshold` selects.
+float MinScoreAbove(double threshold);
+
+// Compacts the indices of the score map pixels with score >= min_score into
+// candidates and returns their count. candidates only grows, so a buffer
+// kept across calls stops allocating once it has seen the largest map.
+size_t SelectCandidates(const float* score_array, int size, float min_score,
+                        std::vector<int>& candidates);
+
+// Restores the quads of the EAST RBOX geometry (4 distances + angle per
+// pixel, map stride 4) for the candidate pixels. Writes 9 floats per
+// candidate to quad_data: x0 y0 x1 y1 x2 y2 x3 y3 score.
+void RestoreRBox(const float* geo_array, const float* score_array, int width,
+                 const int* candidates, size_t count, float* quad_data);
@@ -0,0 +1,97 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "resize_kernel.h"
+#include <algorithm>
+#include "common/bilinear.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RESIZE_USE_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define RESIZE_USE_NEON
+#endif
+
+// horizontal pass of one source row into an RGB float row
+static void ResizeRow(const unsigned char* src, int src_w, const int* xofs,
+                      const float* xalpha, int dst_w, float* row) {
+  BilinearRowBGR(src, src_w, xofs, xalpha, dst_w, row, row + 1, row + 2, 3);
+}
+
+// dst = r0 * (1 - a) + r1 * a
+static void BlendRows(const float* r0, const float* r1, float a, int size,
+                      float* dst) {
+  int i = 0;
+  float b = 1.0f - a;
+#if defined(RESIZE_USE_SSE2)
+  __m128 va = _mm_set1_ps(a);
+  __m128 vb = _mm_set1_ps(b);
+  for (; i + 4 <= size; i += 4) {
+    __m128 v = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(r0 + i), vb),
+                          _mm_mul_ps(_mm_loadu_ps(r1 + i), va));
+    _mm_storeu_ps(dst + i, v);
+  }
+#elif defined(RESIZE_USE_NEON)
+  float32x4_t va = vdupq_n_f32(a);
+  float32x4_t vb = vdupq_n_f32(b);
+  for (; i + 4 <= size; i += 4) {
+    float32x4_t v = vmlaq_f32(vmulq_f32(vld1q_f32(r0 + i), vb),
+                              vld1q_f32(r1 + i), va);
+    vst1q_f32(dst + i, v);
+  }
+#endif
+  for (; i < size; i++) {
+    dst[i] = r0[i] * b + r1[i] * a;
+  }
+}
+
+void ResizeBGRToRGBFloat(const unsigned char* src, int src_w, int src_h,
+                         size_t src_step, float* dst, int dst_w, int dst_h,
+                         size_t dst_stride, ResizeBuffers& buffers) {
+  buffers.xofs.resize(dst_w);
+  buffers.xalpha.resize(dst_w);
+  double scale_x = double(src_w) / dst_w;
+  double scale_y = double(src_h) / dst_h;
+  for (int x = 0; x < dst_w; x++) {
+    BilinearCoord(x, scale_x, src_w, &buffers.xofs[x], &buffers.xalpha[x]);
+  }
+  const int* xofs = buffers.xofs.data();
+  const float* xalpha = buffers.xalpha.data();
+
+  // the two source rows around the current output row, kept horizontally
+  // resized so each source row goes through the horizontal pass once
+  int row_size = dst_w * 3;
+  buffers.rows[0].resize(row_size);
+  buffers.rows[1].resize(row_size);
+  float* rows[2] = {buffers.rows[0].data(), buffers.rows[1].data()};
+  int row_y[2] = {-1, -1};
+
+  for (int y = 0; y < dst_h; y++) {
+    int y0;
+    float a;
+    BilinearCoord(y, scale_y, src_h, &y0, &a);
+    int y1 = std::min(y0 + 1, src_h - 1);
+    if (row_y[0] != y0) {
+      if (row_y[1] == y0) {
+        std::swap(rows[0], rows[1]);
+        std::swap(row_y[0], row_y[1]);
+      } else {
+        ResizeRow(src + y0 * src_step, src_w, xofs, xalpha, dst_w, rows[0]);
+        row_y[0] = y0;
+      }
+    }
+    float* out = dst + y * dst_stride;
+    if (a == 0) {
+      std::copy(rows[0], rows[0] + row_size, out);
+      continue;
+    }
+    if (row_y[1] != y1) {
+      ResizeRow(src + y1 * src_step, src_w, xofs, xalpha, dst_w, rows[1]);
+      row_y[1] = y1;
+    }
+    BlendRows(rows[0], rows[1], a, row_size, out);
+  }
+}
@@ -0,0 +1,23 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Scratch memory of ResizeBGRToRGBFloat, keep it across calls to avoid
+// allocations.
+struct ResizeBuffers {
+  std::vector<int> xofs;
+  std::vector<float> xalpha;
+  std::vector<float> rows[2];
+};
+
+// Fused BGR->RGB conversion, bilinear resize and float conversion. Reads
+// the 8-bit BGR source once and writes interleaved RGB floats in [0, 255]
+// to dst, dst_stride floats per row. Sampling follows cv::resize with
+// INTER_LINEAR (half pixel centers, clamped borders).
+void ResizeBGRToRGBFloat(const unsigned char* src, int src_w, int src_h,
+                         size_t src_step, float* dst, int dst_w, int dst_h,
+                         size_t dst_stride, ResizeBuffers& buffers);
@@ -0,0 +1,109 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "score_blobs.h"
+
+static int FindRoot(std::vector<int>& parent, int i) {
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+static void Unite(std::vector<int>& parent, int a, int b) {
+  a = FindRoot(parent, a);
+  b = FindRoot(parent, b);
+  // the earlier run stays the root, labels do not depend on the scan
+  if (a < b) {
+    parent[b] = a;
+  } else if (b < a) {
+    parent[a] = b;
+  }
+}
+
+size_t FilterCandidateBlobs(int width, int min_blob_area, int subsample_area,
+                            int subsample_step, int* candidates, size_t count,
+                            BlobBuffers& buffers) {
+  if (count == 0 || width <= 0) {
+    return count;
+  }
+  buffers.run_row.clear();
+  buffers.run_x0.clear();
+  buffers.run_x1.clear();
+  buffers.run_begin.clear();
+  for (size_t i = 0; i < count; i++) {
+    int idx = candidates[i];
+    int y = idx / width;
+    int x = idx - y * width;
+    if (i == 0 || idx != candidates[i - 1] + 1 || x == 0) {
+      buffers.run_row.push_back(y);
+      buffers.run_x0.push_back(x);
+      buffers.run_x1.push_back(x);
+      buffers.run_begin.push_back(int(i));
+    } else {
+      buffers.run_x1.back() = x;
+    }
+  }
+  int num_runs = int(buffers.run_row.size());
+  buffers.run_begin.push_back(int(count));
+
+  std::vector<int>& parent = buffers.parent;
+  parent.resize(num_runs);
+  for (int r = 0; r < num_runs; r++) {
+    parent[r] = r;
+  }
+  // merge the runs of each row with the touching runs of the row above,
+  // both lists are sorted by column so one sweep finds all overlaps
+  const int* row = buffers.run_row.data();
+  const int* x0 = buffers.run_x0.data();
+  const int* x1 = buffers.run_x1.data();
+  int prev_begin = 0;
+  int prev_end = 0;
+  int r = 0;
+  while (r < num_runs) {
+    int begin = r;
+    while (r < num_runs && row[r] == row[begin]) r++;
+    int end = r;
+    if (prev_end > prev_begin && row[prev_begin] + 1 == row[begin]) {
+      int p = prev_begin;
+      for (int c = begin; c < end; c++) {
+        while (p < prev_end && x1[p] + 1 < x0[c]) p++;
+        for (int q = p; q < prev_end && x0[q] <= x1[c] + 1; q++) {
+          Unite(parent, q, c);
+        }
+      }
+    }
+    prev_begin = begin;
+    prev_end = end;
+  }
+
+  std::vector<int>& area = buffers.area;
+  area.assign(num_runs, 0);
+  for (int i = 0; i < num_runs; i++) {
+    area[FindRoot(parent, i)] += x1[i] - x0[i] + 1;
+  }
+
+  // runs are in row-major order, writing back in run order keeps it
+  size_t out = 0;
+  for (int i = 0; i < num_runs; i++) {
+    int blob_area = area[FindRoot(parent, i)];
+    if (blob_area < min_blob_area) continue;
+    const int* run = candidates + buffers.run_begin[i];
+    int run_size = buffers.run_begin[i + 1] - buffers.run_begin[i];
+    if (subsample_area > 0 && subsample_step > 1 &&
+        blob_area >= subsample_area) {
+      int first = (subsample_step - (x0[i] + row[i]) % subsample_step) %
+                  subsample_step;
+      for (int k = first; k < run_size; k += subsample_step) {
+        candidates[out++] = run[k];
+      }
+    } else {
+      for (int k = 0; k < run_size; k++) {
+        candidates[out++] = run[k];
+      }
+    }
+  }
+  return out;
+}
@@ -0,0 +1,31 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Scratch memory of FilterCandidateBlobs, keep it across calls to avoid
+// allocations.
+struct BlobBuffers {
+  // horizontal runs of candidates: row, first/last column, first candidate
+  std::vector<int> run_row;
+  std::vector<int> run_x0;
+  std::vector<int> run_x1;
+  std::vector<int> run_begin;
+  // union-find over the runs, area is valid at the roots
+  std::vector<int> parent;
+  std::vector<int> area;
+};
+
+// Groups the candidates of a score map (row-major indices as returned by
+// SelectCandidates) into 8-connected blobs built from row runs, then
+// compacts candidates in place and returns the new count:
+//  - blobs smaller than min_blob_area pixels are dropped,
+//  - blobs of at least subsample_area pixels keep only the pixels with
+//    (x + y) % subsample_step == 0; subsample_area <= 0 keeps all pixels.
+// The kept candidates stay in row-major order, which LANMS relies on.
+size_t FilterCandidateBlobs(int width, int min_blob_area, int subsample_area,
+                            int subsample_step, int* candidates, size_t count,
+                            BlobBuffers& buffers);
@@ -17,7 +17,9 @@ int main(int argc, char* argv[]) {
   OrtEnv* env;
   g_ort->CreateEnv(ORT_LOGGING_LEVEL_WARNING, "idcard", &env);
   Detector detector(g_ort, env);
-  detector.InitModel(model_path);
+  if (!detector.InitModel(model_path)) {
+    return 1;
+  }
   std::vector<std::vector<cv::Point2f> > textlines;
   cv::Mat image = cv::imread(image_path);
   detector.Predict(image, textlines);
@@ -0,0 +1,123 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "card_rectifier.h"
+#include "spdlog/spdlog.h"
+
+// outline search runs on a copy with this longest side
+static const int kSearchSide = 640;
+// the card must cover this fraction of the frame
+static const double kMinAreaRatio = 0.1;
+// ID-1 cards are 85.6 x 54 mm, allow for perspective
+static const double kMinAspect = 1.3;
+static const double kMaxAspect = 1.9;
+
+static double Distance(const cv::Point2f& a, const cv::Point2f& b) {
+  return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+}
+
+// Orders the corners clockwise from the top-left and rotates the order so
+// the first edge is a long one, i.e. the card comes out in landscape.
+static void OrderCorners(cv::Point2f* quad) {
+  cv::Point2f center(0, 0);
+  for (int i = 0; i < 4; i++) {
+    center.x += quad[i].x / 4;
+    center.y += quad[i].y / 4;
+  }
+  std::sort(quad, quad + 4, [&center](const cv::Point2f& a,
+                                      const cv::Point2f& b) {
+    return std::atan2(a.y - center.y, a.x - center.x) <
+           std::atan2(b.y - center.y, b.x - center.x);
+  });
+  // angles run from -pi, start at the corner closest to the top-left
+  int first = 0;
+  for (int i = 1; i < 4; i++) {
+    if (quad[i].x + quad[i].y < quad[first].x + quad[first].y) first = i;
+  }
+  std::rotate(quad, quad + first, quad + 4);
+  if (Distance(quad[0], quad[1]) < Distance(quad[1], quad[2])) {
+    std::rotate(quad, quad + 3, quad + 4);
+  }
+}
+
+bool CardRectifier::FindCard(const cv::Mat& image, cv::Point2f* quad) const {
+  double scale =
+      std::min(1.0, double(kSearchSide) / std::max(image.cols, image.rows));
+  cv::Mat small;
+  cv::resize(image, small,
+             cv::Size(std::max(1, int(image.cols * scale)),
+                      std::max(1, int(image.rows * scale))),
+             0, 0, cv::INTER_AREA);
+  cv::Mat gray;
+  if (small.channels() == 1) {
+    gray = small;
+  } else if (small.channels() == 4) {
+    cv::cvtColor(small, gray, cv::COLOR_BGRA2GRAY);
+  } else {
+    cv::cvtColor(small, gray, cv::COLOR_BGR2GRAY);
+  }
+  cv::GaussianBlur(gray, gray, cv::Size(5, 5), 0);
+  cv::Mat edges;
+  cv::Canny(gray, edges, 50, 150);
+  cv::dilate(edges, edges,
+             cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3)));
+
+  std::vector<std::vector<cv::Point>> contours;
+  cv::findContours(edges, contours, cv::RETR_EXTERNAL,
+                   cv::CHAIN_APPROX_SIMPLE);
+  double min_area = kMinAreaRatio * small.cols * small.rows;
+  double best_area = 0;
+  for (const auto& contour : contours) {
+    std::vector<cv::Point> hull;
+    cv::convexHull(contour, hull);
+    double area = cv::contourArea(hull);
+    if (area < min_area || area <= best_area) continue;
+
+    std::vector<cv::Point> approx;
+    cv::approxPolyDP(hull, approx, 0.02 * cv::arcLength(hull, true), true);
+    cv::Point2f corners[4];
+    if (approx.size() == 4) {
+      for (int i = 0; i < 4; i++) corners[i] = approx[i];
+    } else {
+      // rounded card corners often leave more than 4 vertices, fall back
+      // to the enclosing rectangle when the hull fills most of it
+      cv::RotatedRect box = cv::minAreaRect(hull);
+      if (area < 0.85 * box.size.area()) continue;
+      box.points(corners);
+    }
+    OrderCorners(corners);
+    double long_side = (Distance(corners[0], corners[1]) +
+                        Distance(corners[2], corners[3])) / 2;
+    double short_side = (Distance(corners[1], corners[2]) +
+                         Distance(corners[3], corners[0])) / 2;
+    double aspect = long_side / std::max(short_side, 1.0);
+    if (aspect < kMinAspect || aspect > kMaxAspect) continue;
+
+    best_area = area;
+    for (int i = 0; i < 4; i++) {
+      quad[i] = cv::Point2f(corners[i].x / scale, corners[i].y / scale);
+    }
+  }
+  return best_area > 0;
+}
+
+bool CardRectifier::Rectify(const cv::Mat& image, cv::Mat& card,
+                            std::vector<cv::Point2f>* corners) const {
+  cv::Point2f quad[4];
+  if (!FindCard(image, quad)) {
+    SPDLOG_DEBUG("no card outline found");
+    return false;
+  }
+  cv::Point2f dst[4] = {
+      cv::Point2f(0, 0), cv::Point2f(card_width_, 0),
+      cv::Point2f(card_width_, card_height_), cv::Point2f(0, card_height_)};
+  cv::Mat transform = cv::getPerspectiveTransform(quad, dst);
+  cv::warpPerspective(image, card, transform,
+                      cv::Size(card_width_, card_height_), cv::INTER_LINEAR,
+                      cv::BORDER_REPLICATE);
+  if (corners != nullptr) {
+    corners->assign(quad, quad + 4);
+  }
+  return true;
+}
@@ -0,0 +1,30 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <vector>
+#include "common/common.h"
+
+// Locates the card in a photo from its outline and warps it to a canonical
+// landscape card image, so detection and recognition run on the card only
+// instead of on a downscaled full frame.
+class TUYUIDCARD_API CardRectifier {
+ public:
+  CardRectifier(int card_width, int card_height)
+      : card_width_(card_width), card_height_(card_height) {}
+
+  // Finds the largest card shaped quadrilateral and warps it into card.
+  // Returns false, leaving card untouched, when there is none. corners gets
+  // the card corners in the source image (top-left, top-right, bottom-right,
+  // bottom-left) when given.
+  bool Rectify(const cv::Mat& image, cv::Mat& card,
+               std::vector<cv::Point2f>* corners = nullptr) const;
+
+ private:
+  bool FindCard(const cv::Mat& image, cv::Point2f* quad) const;
+
+  int card_width_;
+  int card_height_;
+};
@@ -0,0 +1,345 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1900)
+#pragma execution_character_set("utf-8")
+#endif
+#include "fields.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <regex>
+
+const std::vector<std::string>& EthnicityNames() {
+  static const std::vector<std::string> names = {
+      "汉",     "蒙古",   "回",     "藏",     "维吾尔", "苗",     "彝",
+      "壮",     "布依",   "朝鲜",   "满",     "侗",     "瑶",     "白",
+      "土家",   "哈尼",   "哈萨克", "傣",     "黎",     "傈僳",   "佤",
+      "畲",     "高山",   "拉祜",   "水",     "东乡",   "纳西",   "景颇",
+      "柯尔克孜", "土",   "达斡尔", "仫佬",   "羌",     "布朗",   "撒拉",
+      "毛南",   "仡佬",   "锡伯",   "阿昌",   "普米",   "塔吉克", "怒",
+      "乌孜别克", "俄罗斯", "鄂温克", "德昂", "保安",   "裕固",   "京",
+      "塔塔尔", "独龙",   "鄂伦春", "赫哲",   "门巴",   "珞巴",   "基诺"};
+  return names;
+}
+
+// ISO 7064 MOD 11-2 weights of the first 17 digits and the check code of
+// every weighted sum mod 11
+static const int kIdWeights[17] = {7, 9, 10, 5, 8, 4, 2, 1, 6,
+                                   3, 7, 9, 10, 5, 8, 4, 2};
+static const char kIdCheckCodes[] = "10X98765432";
+
+bool IsValidIdNumber(const std::string& value) {
+  if (value.size() != 18) return false;
+  int sum = 0;
+  for (int i = 0; i < 17; i++) {
+    if (value[i] < '0' || value[i] > '9') return false;
+    sum += (value[i] - '0') * kIdWeights[i];
+  }
+  char last = value[17] == 'x' ? 'X' : value[17];
+  return last == kIdCheckCodes[sum % 11];
+}
+
+// 17 digits tracked as (position, weighted sum mod 11) and the one check
+// code that sum allows, so only numbers with a valid check code accept.
+static void BuildIdNumberGrammar(FieldGrammar& grammar) {
+  int digit_labels[10];
+  for (int d = 0; d < 10; d++) {
+    digit_labels[d] = AlphabetLabel(std::string(1, char('0' + d)));
+  }
+  std::vector<int> sums(11, -1);
+  sums[0] = grammar.start();
+  for (int i = 0; i < 17; i++) {
+    std::vector<int> next_sums(11);
+    for (int r = 0; r < 11; r++) {
+      next_sums[r] = grammar.AddState();
+    }
+    for (int r = 0; r < 11; r++) {
+      if (sums[r] < 0) continue;
+      for (int d = 0; d < 10; d++) {
+        grammar.AddArc(sums[r], digit_labels[d],
+                       next_sums[(r + d * kIdWeights[i]) % 11]);
+      }
+    }
+    sums.swap(next_sums);
+  }
+  int end = grammar.AddState();
+  grammar.Accept(end);
+  for (int r = 0; r < 11; r++) {
+    int label = AlphabetLabel(std::string(1, kIdCheckCodes[r]));
+    grammar.AddArc(sums[r], label, end);
+  }
+}
+
+static const char kDigits[] = "0123456789";
+
+// YYYY.MM.DD
+static std::vector<int> DottedDate(FieldGrammar& grammar,
+                                   const std::vector<int>& from) {
+  std::vector<int> states = grammar.Repeat(from, kDigits, 4, 4);
+  states = grammar.Repeat(grammar.Literal(states, "."), kDigits, 2, 2);
+  return grammar.Repeat(grammar.Literal(states, "."), kDigits, 2, 2);
+}
+
+const FieldGrammar* FieldGrammarFor(const std::string& key) {
+  static const std::map<std::string, FieldGrammar> grammars = [] {
+    std::map<std::string, FieldGrammar> map;
+    FieldGrammar& gender = map[kFieldGender];
+    gender.Accept(gender.Words({gender.start()}, {"男", "女"}));
+
+    FieldGrammar& ethnicity = map[kFieldEthnicity];
+    ethnicity.Accept(ethnicity.Words({ethnicity.start()}, EthnicityNames()));
+
+    // YYYY年M月D日, month and day without a leading zero
+    FieldGrammar& birth = map[kFieldBirth];
+    std::vector<int> states = birth.Repeat({birth.start()}, kDigits, 4, 4);
+    states = birth.Repeat(birth.Literal(states, "年"), kDigits, 1, 2);
+    states = birth.Repeat(birth.Literal(states, "月"), kDigits, 1, 2);
+    birth.Accept(birth.Literal(states, "日"));
+
+    BuildIdNumberGrammar(map[kFieldIdNumber]);
+
+    // YYYY.MM.DD-YYYY.MM.DD or YYYY.MM.DD-长期
+    FieldGrammar& validity = map[kFieldValidity];
+    states = validity.Literal(DottedDate(validity, {validity.start()}), "-");
+    validity.Accept(DottedDate(validity, states));
+    validity.Accept(validity.Literal(states, "长期"));
+    return map;
+  }();
+  auto it = grammars.find(key);
+  return it != grammars.end() ? &it->second : nullptr;
+}
+
+const ClassSubset* ClassSubsetFor(const std::string& key) {
+  static const std::map<std::string, ClassSubset> subsets = [] {
+    std::map<std::string, ClassSubset> map;
+    const char* const keys[] = {kFieldGender, kFieldEthnicity, kFieldBirth,
+                                kFieldIdNumber, kFieldValidity};
+    for (const char* field : keys) {
+      map.emplace(field, ClassSubset(*FieldGrammarFor(field)));
+    }
+    return map;
+  }();
+  auto it = subsets.find(key);
+  return it != subsets.end() ? &it->second : nullptr;
+}
+
+bool HasFieldFormat(const std::string& key) {
+  return key == kFieldGender || key == kFieldEthnicity ||
+         key == kFieldBirth || key == kFieldIdNumber ||
+         key == kFieldValidity;
+}
+
+bool ValidateField(const std::string& key, const std::string& value) {
+  if (key == kFieldGender) {
+    return value == "男" || value == "女";
+  }
+  if (key == kFieldEthnicity) {
+    const std::vector<std::string>& names = EthnicityNames();
+    return std::find(names.begin(), names.end(), value) != names.end();
+  }
+  if (key == kFieldBirth) {
+    static const std::regex birth("[0-9]{4}年[0-9]{1,2}月[0-9]{1,2}日");
+    return std::regex_match(value, birth);
+  }
+  if (key == kFieldIdNumber) {
+    return IsValidIdNumber(value);
+  }
+  if (key == kFieldValidity) {
+    static const std::regex validity(
+        "[0-9]{4}\\.[0-9]{2}\\.[0-9]{2}-([0-9]{4}\\.[0-9]{2}\\.[0-9]{2}|长期)");
+    return std::regex_match(value, validity);
+  }
+  return !value.empty();
+}
+
+// Text lines whose vertical centers are close enough to sit on one printed
+// row of the card, joined left to right.
+struct TextRow {
+  float center_y;
+  float height;
+  std::vector<std::pair<int, const std::string*>> items;
+  std::string text;
+};
+
+static std::string RemoveSpaces(const std::string& text) {
+  std::string out;
+  out.reserve(text.size());
+  for (char c : text) {
+    if (c != ' ' && c != '\t') out += c;
+  }
+  return out;
+}
+
+static void GroupRows(const std::vector<std::vector<cv::Point2f>>& textlines,
+                      const std::vector<std::string>& texts,
+                      std::vector<TextRow>& rows) {
+  std::vector<std::pair<cv::Rect, const std::string*>> boxes;
+  for (size_t i = 0; i < textlines.size() && i < texts.size(); i++) {
+    if (texts[i].empty() || textlines[i].empty()) continue;
+    boxes.emplace_back(cv::boundingRect(textlines[i]), &texts[i]);
+  }
+  std::sort(boxes.begin(), boxes.end(),
+            [](const std::pair<cv::Rect, const std::string*>& a,
+               const std::pair<cv::Rect, const std::string*>& b) {
+              return a.first.y * 2 + a.first.height <
+                     b.first.y * 2 + b.first.height;
+            });
+
+  rows.clear();
+  for (auto& box : boxes) {
+    float center_y = box.first.y + box.first.height / 2.0f;
+    if (rows.empty() ||
+        center_y - rows.back().center_y >
+            std::min(rows.back().height, float(box.first.height)) / 2) {
+      rows.push_back(TextRow{center_y, float(box.first.height), {}, ""});
+    }
+    rows.back().items.emplace_back(box.first.x, box.second);
+  }
+  for (auto& row : rows) {
+    std::sort(row.items.begin(), row.items.end(),
+              [](const std::pair<int, const std::string*>& a,
+                 const std::pair<int, const std::string*>& b) {
+                return a.first < b.first;
+              });
+    for (auto& item : row.items) {
+      row.text += RemoveSpaces(*item.second);
+    }
+  }
+}
+
+// The text after the label when the row contains it.
+static bool AfterLabel(const std::string& text, const char* label,
+                       std::string& value) {
+  size_t pos = text.find(label);
+  if (pos == std::string::npos) return false;
+  value = text.substr(pos + strlen(label));
+  return true;
+}
+
+static std::string& FieldValue(
+    std::vector<std::pair<std::string, std::string>>& infos, const char* key) {
+  for (auto& info : infos) {
+    if (info.first == key) return info.second;
+  }
+  infos.emplace_back(key, "");
+  return infos.back().second;
+}
+
+static void ResetFields(
+    const std::vector<const char*>& keys,
+    std::vector<std::pair<std::string, std::string>>& infos) {
+  infos.clear();
+  for (const char* key : keys) {
+    infos.emplace_back(key, "");
+  }
+}
+
+void ExtractHeadFields(
+    const std::vector<std::vector<cv::Point2f>>& textlines,
+    const std::vector<std::string>& texts,
+    std::vector<std::pair<std::string, std::string>>& infos) {
+  ResetFields({kFieldName, kFieldGender, kFieldEthnicity, kFieldBirth,
+               kFieldAddress, kFieldIdNumber},
+              infos);
+  std::vector<TextRow> rows;
+  GroupRows(textlines, texts, rows);
+
+  static const std::regex id_number("[0-9]{17}[0-9Xx]");
+  static const std::regex birth("[0-9]{4}年[0-9]{1,2}月[0-9]{1,2}日");
+  int birth_row = -1;
+  int id_row = -1;
+  int address_row = -1;
+  std::smatch match;
+  for (size_t r = 0; r < rows.size(); r++) {
+    const std::string& text = rows[r].text;
+    std::string value;
+    if (std::regex_search(text, match, id_number)) {
+      // keep the first number with a valid check code
+      if (id_row < 0 || !IsValidIdNumber(FieldValue(infos, kFieldIdNumber))) {
+        FieldValue(infos, kFieldIdNumber) = match.str();
+        id_row = r;
+      }
+    } else if (std::regex_search(text, match, birth)) {
+      FieldValue(infos, kFieldBirth) = match.str();
+      birth_row = r;
+    } else if (AfterLabel(text, "姓名", value)) {
+      FieldValue(infos, kFieldName) = value;
+    } else if (AfterLabel(text, "住址", value)) {
+      FieldValue(infos, kFieldAddress) = value;
+      address_row = r;
+    }
+
+    // gender and ethnicity share a row: 性别男民族汉, the row starts with
+    // the gender when its label was lost
+    std::string gender;
+    if (!AfterLabel(text, "性别", gender) &&
+        text.find("民族") != std::string::npos) {
+      gender = text;
+    }
+    if (gender.compare(0, strlen("男"), "男") == 0) {
+      FieldValue(infos, kFieldGender) = "男";
+    } else if (gender.compare(0, strlen("女"), "女") == 0) {
+      FieldValue(infos, kFieldGender) = "女";
+    }
+    std::string ethnicity;
+    if (AfterLabel(text, "民族", ethnicity)) {
+      for (const std::string& name : EthnicityNames()) {
+        // the longest name wins, e.g. 土家 over 土
+        if (ethnicity.compare(0, name.size(), name) == 0 &&
+            name.size() > FieldValue(infos, kFieldEthnicity).size()) {
+          FieldValue(infos, kFieldEthnicity) = name;
+        }
+      }
+    }
+  }
+
+  // the address continues on the rows down to the id number; when its
+  // label was lost it starts below the birth row
+  if (address_row < 0 && birth_row >= 0) {
+    address_row = birth_row;
+  }
+  if (address_row >= 0) {
+    int end = id_row > address_row ? id_row : int(rows.size());
+    std::string& address = FieldValue(infos, kFieldAddress);
+    for (int r = address_row + 1; r < end; r++) {
+      address += rows[r].text;
+    }
+  }
+  // the name is the top row when its label was lost
+  std::string& name = FieldValue(infos, kFieldName);
+  if (name.empty() && !rows.empty() && birth_row != 0 && id_row != 0 &&
+      rows[0].text.find("性别") == std::string::npos) {
+    name = rows[0].text;
+  }
+}
+
+void ExtractEmblemFields(
+    const std::vector<std::vector<cv::Point2f>>& textlines,
+    const std::vector<std::string>& texts,
+    std::vector<std::pair<std::string, std::string>>& infos) {
+  ResetFields({kFieldAuthority, kFieldValidity}, infos);
+  std::vector<TextRow> rows;
+  GroupRows(textlines, texts, rows);
+
+  static const std::regex validity(
+      "[0-9]{4}\\.[0-9]{2}\\.[0-9]{2}-([0-9]{4}\\.[0-9]{2}\\.[0-9]{2}|长期)");
+  std::smatch match;
+  for (const TextRow& row : rows) {
+    std::string value;
+    if (std::regex_search(row.text, match, validity)) {
+      FieldValue(infos, kFieldValidity) = match.str();
+    } else if (AfterLabel(row.text, "签发机关", value)) {
+      FieldValue(infos, kFieldAuthority) = value;
+    }
+  }
+  // without its label the authority is the row naming a police office
+  std::string& authority = FieldValue(infos, kFieldAuthority);
+  for (size_t r = 0; authority.empty() && r < rows.size(); r++) {
+    const std::string& text = rows[r].text;
+    if (text.find("公安") != std::string::npos) {
+      authority = text;
+    }
+  }
+}
@@ -0,0 +1,59 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+#include "rec/class_subset.h"
+#include "rec/field_grammar.h"
+
+// Keys of the structured fields in the infos output of IDCardOCR.
+// front side
+const char* const kFieldName = "name";
+const char* const kFieldGender = "gender";
+const char* const kFieldEthnicity = "ethnicity";
+const char* const kFieldBirth = "birth";
+const char* const kFieldAddress = "address";
+const char* const kFieldIdNumber = "id_number";
+// back side
+const char* const kFieldAuthority = "authority";
+const char* const kFieldValidity = "validity";
+
+// The 56 ethnic groups as printed on the card, without the trailing 族.
+const std::vector<std::string>& EthnicityNames();
+
+// 17 digits and a digit or X with a valid ISO 7064 MOD 11-2 check code.
+bool IsValidIdNumber(const std::string& value);
+
+// The grammar that decoding of the field is constrained to, nullptr for
+// free text fields. Everything it accepts passes ValidateField.
+const FieldGrammar* FieldGrammarFor(const std::string& key);
+
+// The classes of the field grammar with the grammar over them, nullptr for
+// free text fields. The ID number reads from 11 classes and the dates from
+// a dozen or so instead of the whole alphabet.
+const ClassSubset* ClassSubsetFor(const std::string& key);
+
+// Whether the field has a fixed format that ValidateField can check.
+bool HasFieldFormat(const std::string& key);
+
+// Checks a recognized value against the format of its field. Fields
+// without a fixed format pass when they are not empty.
+bool ValidateField(const std::string& key, const std::string& value);
+
+// Maps the recognized text lines of a card side to its fields by their
+// labels, their row order on the card and the value formats. textlines
+// and texts are parallel, as returned by the detector and the recognizer.
+// infos gets every field of the side in a fixed order, a field that was
+// not found has an empty value.
+void ExtractHeadFields(
+    const std::vector<std::vector<cv::Point2f>>& textlines,
+    const std::vector<std::string>& texts,
+    std::vector<std::pair<std::string, std::string>>& infos);
+void ExtractEmblemFields(
+    const std::vector<std::vector<cv::Point2f>>& textlines,
+    const std::vector<std::string>& texts,
+    std::vector<std::pair<std::string, std::string>>& infos);
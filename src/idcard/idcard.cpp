@@ -1,6 +1,10 @@
 #include "idcard.h"
+#include <cmath>
 #include "det/detector.h"
+#include "idcard/fields.h"
+#include "idcard/image_decode.h"
 #include "rec/recognizer.h"
+#include "spdlog/spdlog.h"
 
 IDCardOCR::~IDCardOCR() {
   if (detector_ != nullptr) {
@@ -11,36 +15,160 @@ IDCardOCR::~IDCardOCR() {
   }
 }
 
-void IDCardOCR::InitModel(const std::string& det_model,
-                          const std::string& rec_model) {
-  detector_ = new Detector(ort_api_, env_);
+bool IDCardOCR::InitModel(const std::string& det_model,
+                          const std::string& rec_model,
+                          const SessionConfig& config) {
+  detector_ = new Detector(ort_api_, env_, config_.detector);
   recognizer_ = new Recognizer(ort_api_, env_);
-  detector_->InitModel(det_model);
-  recognizer_->InitModel(rec_model);
+  recognizer_->SetDecodeConfig(config_.decode);
+  return detector_->InitModel(det_model, config) &&
+         recognizer_->InitModel(rec_model, config);
 }
 
-void IDCardOCR::ParseHead(
-    const cv::Mat& image,
+bool IDCardOCR::RectifyCard(const cv::Mat& image, cv::Mat& card) const {
+  return config_.rectify_card && rectifier_.Rectify(image, card);
+}
+
+bool IDCardOCR::ParseTemplate(
+    const cv::Mat& card, const std::vector<FieldTemplate>& fields,
     std::vector<std::pair<std::string, std::string>>& infos) {
+  std::vector<TemplateLine> lines;
+  CropTemplateLines(card, fields, lines);
+  std::vector<cv::Mat> text_images;
+  std::vector<const ClassSubset*> subsets;
+  for (auto& line : lines) {
+    text_images.push_back(line.image);
+    const FieldTemplate& field = fields[line.field];
+    // a grammar describes a whole value, fields spanning lines stay free
+    subsets.push_back(config_.constrain_fields && field.lines == 1
+                          ? ClassSubsetFor(field.key)
+                          : nullptr);
+  }
+  std::vector<RecResult> results;
+  recognizer_->PredictBatch(text_images, subsets, results);
+  std::vector<std::string> values(fields.size());
+  std::vector<float> min_char_probs(fields.size(), 1.0f);
+  // a line its grammar rejected leaves the field unreadable
+  std::vector<char> accepted(fields.size(), 1);
+  for (size_t i = 0; i < lines.size(); i++) {
+    values[lines[i].field] += results[i].text;
+    if (!results[i].accepted) accepted[lines[i].field] = 0;
+    for (float prob : results[i].char_probs) {
+      float& min_prob = min_char_probs[lines[i].field];
+      min_prob = std::min(min_prob, prob);
+    }
+  }
+
+  // the template is trusted when enough of the fields with a fixed format
+  // read as valid values, otherwise the card is probably misaligned
+  int checked = 0;
+  int passed = 0;
+  for (size_t i = 0; i < fields.size(); i++) {
+    if (!HasFieldFormat(fields[i].key)) continue;
+    checked++;
+    bool constrained =
+        config_.constrain_fields && FieldGrammarFor(fields[i].key) != nullptr;
+    if (accepted[i] && ValidateField(fields[i].key, values[i]) &&
+        (!constrained ||
+         min_char_probs[i] >= config_.constrained_min_char_prob)) {
+      passed++;
+    }
+  }
+  float confidence = checked > 0 ? float(passed) / checked : 0.0f;
+  SPDLOG_DEBUG("template confidence {}", confidence);
+  if (confidence < config_.template_min_confidence) {
+    return false;
+  }
+
+  infos.clear();
+  for (size_t i = 0; i < fields.size(); i++) {
+    infos.emplace_back(fields[i].key, values[i]);
+  }
+  return true;
+}
+
+void IDCardOCR::ParseSide(
+    const cv::Mat& image, bool rectified,
+    const std::vector<FieldTemplate>& fields, FieldExtractor extract,
+    std::vector<std::pair<std::string, std::string>>& infos) {
+  if (rectified && config_.use_layout_template &&
+      ParseTemplate(image, fields, infos)) {
+    return;
+  }
   std::vector<std::vector<cv::Point2f>> textlines;
   detector_->Predict(image, textlines);
+  std::vector<std::string> results =
+      recognizer_->PredictTextLines(image, textlines);
+  extract(textlines, results, infos);
+}
 
-  for (auto textline : textlines) {
-    cv::Rect line_rect = cv::boundingRect(textline);
-    cv::Mat text_image = image(line_rect);
-    std::string res = recognizer_->Predict(text_image);
-    std::cout << res << std::endl;
+bool IDCardOCR::DecodeCard(const uint8_t* data, size_t size, cv::Mat& image,
+                           cv::Mat& card) const {
+  // one decode, reduced only as far as a card spanning min_card_fraction
+  // of the photo still has card_width pixels across
+  int width = 0;
+  int height = 0;
+  bool is_jpeg = false;
+  int scale = 1;
+  // without a card to warp the whole photo is read, at full size
+  if (config_.rectify_card && config_.min_card_fraction > 0 &&
+      ReadImageSize(data, size, &width, &height, &is_jpeg) && is_jpeg) {
+    int min_long_side =
+        int(std::ceil(config_.card_width / config_.min_card_fraction));
+    scale = ReducedDecodeScale(width, height, min_long_side);
   }
+  SPDLOG_DEBUG("decoding at 1/{}", scale);
+  image = DecodeImage(data, size, scale);
+  if (image.empty() || !config_.rectify_card) {
+    return false;
+  }
+  return rectifier_.Rectify(image, card);
+}
+
+void IDCardOCR::ParseHead(
+    const cv::Mat& input_image,
+    std::vector<std::pair<std::string, std::string>>& infos) {
+  cv::Mat card;
+  bool rectified = RectifyCard(input_image, card);
+  ParseSide(rectified ? card : input_image, rectified, HeadTemplate(),
+            ExtractHeadFields, infos);
 }
 
 void IDCardOCR::ParseEmblem(
-    const cv::Mat& image,
+    const cv::Mat& input_image,
     std::vector<std::pair<std::string, std::string>>& infos) {
-  std::vector<std::vector<cv::Point2f>> textlines;
-  detector_->Predict(image, textlines);
-  for (auto textline : textlines) {
-    cv::Rect line_rect = cv::boundingRect(textline);
-    cv::Mat text_image = image(line_rect);
-    std::string res = recognizer_->Predict(text_image);
+  cv::Mat card;
+  bool rectified = RectifyCard(input_image, card);
+  ParseSide(rectified ? card : input_image, rectified, EmblemTemplate(),
+            ExtractEmblemFields, infos);
+}
+
+bool IDCardOCR::ParseHead(
+    const uint8_t* data, size_t size,
+    std::vector<std::pair<std::string, std::string>>& infos) {
+  cv::Mat image;
+  cv::Mat card;
+  bool rectified = DecodeCard(data, size, image, card);
+  if (image.empty()) {
+    infos.clear();
+    return false;
+  }
+  ParseSide(rectified ? card : image, rectified, HeadTemplate(),
+            ExtractHeadFields, infos);
+  return true;
+}
+
+bool IDCardOCR::ParseEmblem(
+    const uint8_t* data, size_t size,
+    std::vector<std::pair<std::string, std::string>>& infos) {
+  cv::Mat image;
+  cv::Mat card;
+  bool rectified = DecodeCard(data, size, image, card);
+  if (image.empty()) {
+    infos.clear();
+    return false;
   }
+  ParseSide(rectified ? card : image, rectified, EmblemTemplate(),
+            ExtractEmblemFields, infos);
+  return true;
 }
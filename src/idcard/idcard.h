@@ -1,23 +1,98 @@
 #pragma once
 #include "common/common.h"
 #include "det/detector.h"
+#include "idcard/card_rectifier.h"
+#include "idcard/layout_template.h"
 #include "rec/recognizer.h"
 
+struct IDCardConfig {
+  // Locate the card outline and warp it to card_width x card_height before
+  // detection, the whole image is used when no card is found. Off by
+  // default since images are usually passed already cropped to the card,
+  // turn it on for photos where the card is only part of the frame.
+  bool rectify_card = false;
+  int card_width = 856;
+  int card_height = 540;
+  // The smallest share of the photo's long side a card is expected to
+  // span. Encoded JPEGs are decoded once, reduced as far as such a card
+  // still spans card_width pixels; smaller cards are read at less detail.
+  float min_card_fraction = 0.5f;
+  // On a rectified card read the fields at their template positions and
+  // skip the detector. Detection is the fallback when less than
+  // template_min_confidence of the fields with a fixed format validate.
+  // Opt-in, it replaces the detector-driven field grouping.
+  bool use_layout_template = false;
+  float template_min_confidence = 0.6f;
+  // Decode template fields with a fixed format under their grammar and
+  // from only the classes it uses, so they come out well formed. A
+  // misaligned crop still decodes to a well formed value, so such a field
+  // only counts as valid for the template confidence when all its
+  // characters have at least this probability.
+  bool constrain_fields = true;
+  float constrained_min_char_prob = 0.3f;
+  DetectorConfig detector;
+  // CTC decoding of the text lines, a beam width above 1 trades speed for
+  // better sequence scores
+  CTCDecodeConfig decode;
+};
+
 class TUYUIDCARD_API  IDCardOCR {
  public:
-  IDCardOCR(const OrtApi* ort_api, OrtEnv* env)
-      : ort_api_(ort_api), env_(env) {}
+  IDCardOCR(const OrtApi* ort_api, OrtEnv* env,
+            const IDCardConfig& config = IDCardConfig())
+      : ort_api_(ort_api),
+        env_(env),
+        config_(config),
+        rectifier_(config.card_width, config.card_height),
+        detector_(nullptr),
+        recognizer_(nullptr) {}
   virtual ~IDCardOCR();
 
-  void InitModel(const std::string& det_model, const std::string& rec_model);
+  // Returns false when a model can not be loaded.
+  bool InitModel(const std::string& det_model, const std::string& rec_model,
+                 const SessionConfig& config = SessionConfig());
   void ParseHead(const cv::Mat& image,
                  std::vector<std::pair<std::string, std::string>>& infos);
   void ParseEmblem(const cv::Mat& image,
                    std::vector<std::pair<std::string, std::string>>& infos);
+  // Parse from encoded JPEG/PNG bytes. With rectify_card on, JPEG is
+  // decoded reduced close to the resolution the models need, see
+  // min_card_fraction. Returns false and leaves infos empty when the bytes cannot
+  // be decoded.
+  bool ParseHead(const uint8_t* data, size_t size,
+                 std::vector<std::pair<std::string, std::string>>& infos);
+  bool ParseEmblem(const uint8_t* data, size_t size,
+                   std::vector<std::pair<std::string, std::string>>& infos);
 
  private:
+  typedef void (*FieldExtractor)(
+      const std::vector<std::vector<cv::Point2f>>& textlines,
+      const std::vector<std::string>& texts,
+      std::vector<std::pair<std::string, std::string>>& infos);
+
+  // Warps the card out of the image when rectification is on and finds it.
+  bool RectifyCard(const cv::Mat& image, cv::Mat& card) const;
+  // Decodes the bytes into image once, at a scale picked from the header
+  // size and min_card_fraction, and rectifies the card from it. Returns
+  // whether card was filled.
+  bool DecodeCard(const uint8_t* data, size_t size, cv::Mat& image,
+                  cv::Mat& card) const;
+  // Reads one side from the card, or from the whole image when it was not
+  // rectified.
+  void ParseSide(const cv::Mat& image, bool rectified,
+                 const std::vector<FieldTemplate>& fields,
+                 FieldExtractor extract,
+                 std::vector<std::pair<std::string, std::string>>& infos);
+  // Recognizes the template fields of a rectified card, returns false when
+  // the result is not trusted.
+  bool ParseTemplate(const cv::Mat& card,
+                     const std::vector<FieldTemplate>& fields,
+                     std::vector<std::pair<std::string, std::string>>& infos);
+
   const OrtApi* ort_api_;
   OrtEnv* env_;
+  IDCardConfig config_;
+  CardRectifier rectifier_;
   Detector* detector_;
   Recognizer* recognizer_;
 };
\ No newline at end of file
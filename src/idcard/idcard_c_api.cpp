@@ -0,0 +1,280 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "idcard_c_api.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <vector>
+#include "idcard/idcard_pool.h"
+#include "onnxruntime_c_api.h"
+
+struct IDCardEngine {
+  const OrtApi* ort_api;
+  OrtEnv* env;
+  IDCardOCRPool* pool;
+};
+
+// Copies a NUL terminated string, a string that does not fit is cut before
+// the UTF-8 character that crosses the end. Returns false when it was cut.
+static bool CopyString(char* dst, size_t dst_size, const std::string& src) {
+  size_t len = src.size();
+  bool fits = len < dst_size;
+  if (!fits) {
+    len = dst_size - 1;
+    while (len > 0 && (static_cast<unsigned char>(src[len]) & 0xC0) == 0x80) {
+      len--;
+    }
+  }
+  memcpy(dst, src.data(), len);
+  dst[len] = '\0';
+  return fits;
+}
+
+static IDCardStatus CopyFields(const IDCardOCRPool::Infos& infos,
+                               IDCardField* fields, size_t max_fields,
+                               size_t* num_fields) {
+  IDCardStatus status = IDCARD_OK;
+  size_t count = std::min(infos.size(), max_fields);
+  for (size_t i = 0; i < count; i++) {
+    if (!CopyString(fields[i].key, IDCARD_MAX_KEY_SIZE, infos[i].first) ||
+        !CopyString(fields[i].value, IDCARD_MAX_VALUE_SIZE,
+                    infos[i].second)) {
+      status = IDCARD_ERROR_BUFFER_TOO_SMALL;
+    }
+  }
+  if (count < infos.size()) {
+    status = IDCARD_ERROR_BUFFER_TOO_SMALL;
+  }
+  *num_fields = count;
+  return status;
+}
+
+static bool FileExists(const char* path) {
+  std::ifstream file(path, std::ios::binary);
+  return file.good();
+}
+
+// Wraps the request pixels without copying them.
+static IDCardStatus RequestImage(const IDCardRequest& request,
+                                 cv::Mat& image) {
+  if (request.pixels == NULL || request.width <= 0 || request.height <= 0 ||
+      request.stride < static_cast<size_t>(request.width) * 3) {
+    return IDCARD_ERROR_INVALID_ARGUMENT;
+  }
+  image = cv::Mat(request.height, request.width, CV_8UC3,
+                  const_cast<uint8_t*>(request.pixels), request.stride);
+  return IDCARD_OK;
+}
+
+// struct_size of the first versioned IDCardEngineOptions, the smallest
+// accepted; later fields extend it.
+static const size_t kMinOptionsSize =
+    offsetof(IDCardEngineOptions, optimized_model_dir) + sizeof(const char*);
+
+void IDCardEngineOptionsInit(IDCardEngineOptions* options) {
+  if (options == NULL) return;
+  IDCardConfig config;
+  SessionConfig session_config;
+  options->struct_size = sizeof(IDCardEngineOptions);
+  options->num_workers = 0;
+  options->intra_op_num_threads = session_config.intra_op_num_threads;
+  options->rectify_card = config.rectify_card ? 1 : 0;
+  options->optimized_model_dir = NULL;
+}
+
+IDCardStatus IDCardEngineCreate(const char* det_model, const char* rec_model,
+                                const IDCardEngineOptions* options,
+                                IDCardEngine** engine) {
+  if (det_model == NULL || rec_model == NULL || engine == NULL) {
+    return IDCARD_ERROR_INVALID_ARGUMENT;
+  }
+  *engine = NULL;
+  // the fields a caller with an older header does not know keep their
+  // defaults
+  IDCardEngineOptions merged;
+  IDCardEngineOptionsInit(&merged);
+  if (options != NULL) {
+    if (options->struct_size < kMinOptionsSize ||
+        options->struct_size > sizeof(IDCardEngineOptions)) {
+      return IDCARD_ERROR_INVALID_ARGUMENT;
+    }
+    memcpy(&merged, options, options->struct_size);
+  }
+  options = &merged;
+  if (!FileExists(det_model) || !FileExists(rec_model)) {
+    return IDCARD_ERROR_MODEL_NOT_FOUND;
+  }
+
+  IDCardConfig config;
+  config.rectify_card = options->rectify_card != 0;
+  SessionConfig session_config;
+  session_config.intra_op_num_threads = options->intra_op_num_threads;
+  if (options->optimized_model_dir != NULL) {
+    session_config.optimized_model_dir = options->optimized_model_dir;
+  }
+
+  const OrtApi* ort_api = OrtGetApiBase()->GetApi(ORT_API_VERSION);
+  OrtEnv* env = NULL;
+  OrtStatus* status =
+      ort_api->CreateEnv(ORT_LOGGING_LEVEL_WARNING, "idcard", &env);
+  if (status != NULL) {
+    ort_api->ReleaseStatus(status);
+    return IDCARD_ERROR_INTERNAL;
+  }
+  IDCardOCRPool* pool = NULL;
+  IDCardStatus result = IDCARD_ERROR_INTERNAL;
+  try {
+    pool = new IDCardOCRPool(ort_api, env, options->num_workers, config);
+    // load failures are reported by every worker, nothing aborts
+    if (pool->InitModel(det_model, rec_model, session_config)) {
+      *engine = new IDCardEngine{ort_api, env, pool};
+      return IDCARD_OK;
+    }
+    result = IDCARD_ERROR_MODEL_LOAD_FAILED;
+  } catch (...) {
+  }
+  delete pool;
+  ort_api->ReleaseEnv(env);
+  return result;
+}
+
+void IDCardEngineDestroy(IDCardEngine* engine) {
+  if (engine == NULL) return;
+  try {
+    delete engine->pool;
+  } catch (...) {
+  }
+  engine->ort_api->ReleaseEnv(engine->env);
+  delete engine;
+}
+
+IDCardStatus IDCardProcessBGR(IDCardEngine* engine, IDCardSide side,
+                              const uint8_t* pixels, int width, int height,
+                              size_t stride, IDCardField* fields,
+                              size_t max_fields, size_t* num_fields) {
+  IDCardRequest request;
+  memset(&request, 0, sizeof(request));
+  request.side = side;
+  request.pixels = pixels;
+  request.width = width;
+  request.height = height;
+  request.stride = stride;
+  request.fields = fields;
+  request.max_fields = max_fields;
+  IDCardStatus status = IDCardProcessBatch(engine, &request, 1);
+  if (num_fields != NULL) {
+    *num_fields = request.num_fields;
+  }
+  return status;
+}
+
+IDCardStatus IDCardProcessEncoded(IDCardEngine* engine, IDCardSide side,
+                                  const uint8_t* data, size_t size,
+                                  IDCardField* fields, size_t max_fields,
+                                  size_t* num_fields) {
+  IDCardRequest request;
+  memset(&request, 0, sizeof(request));
+  request.side = side;
+  request.encoded = data;
+  request.encoded_size = size;
+  request.fields = fields;
+  request.max_fields = max_fields;
+  IDCardStatus status = IDCardProcessBatch(engine, &request, 1);
+  if (num_fields != NULL) {
+    *num_fields = request.num_fields;
+  }
+  return status;
+}
+
+IDCardStatus IDCardProcessBatch(IDCardEngine* engine, IDCardRequest* requests,
+                                size_t count) {
+  if (engine == NULL || (requests == NULL && count > 0)) {
+    return IDCARD_ERROR_INVALID_ARGUMENT;
+  }
+  std::vector<std::future<IDCardOCRPool::Infos>> futures;
+  try {
+    futures.resize(count);
+  } catch (...) {
+    return IDCARD_ERROR_INTERNAL;
+  }
+
+  // queue everything first so the workers run the batch in parallel; every
+  // queued request is waited for below, the pixels are used until then
+  for (size_t i = 0; i < count; i++) {
+    IDCardRequest& request = requests[i];
+    request.num_fields = 0;
+    if (request.fields == NULL && request.max_fields > 0) {
+      request.status = IDCARD_ERROR_INVALID_ARGUMENT;
+      continue;
+    }
+    bool emblem = request.side == IDCARD_SIDE_EMBLEM;
+    try {
+      if (request.encoded != NULL) {
+        // decoded on the worker, at reduced size where possible
+        if (request.encoded_size == 0) {
+          request.status = IDCARD_ERROR_INVALID_ARGUMENT;
+          continue;
+        }
+        request.status = IDCARD_OK;
+        futures[i] = emblem ? engine->pool->SubmitEmblem(request.encoded,
+                                                         request.encoded_size)
+                            : engine->pool->SubmitHead(request.encoded,
+                                                       request.encoded_size);
+        continue;
+      }
+      cv::Mat image;
+      request.status = RequestImage(request, image);
+      if (request.status != IDCARD_OK) continue;
+      futures[i] = emblem ? engine->pool->SubmitEmblem(image)
+                          : engine->pool->SubmitHead(image);
+    } catch (...) {
+      request.status = IDCARD_ERROR_INTERNAL;
+    }
+  }
+
+  IDCardStatus status = IDCARD_OK;
+  for (size_t i = 0; i < count; i++) {
+    IDCardRequest& request = requests[i];
+    if (futures[i].valid()) {
+      try {
+        IDCardOCRPool::Infos infos = futures[i].get();
+        // every parse returns all fields of the side, empty means the
+        // encoded bytes did not decode
+        request.status =
+            infos.empty() ? IDCARD_ERROR_DECODE_FAILED
+                          : CopyFields(infos, request.fields,
+                                       request.max_fields, &request.num_fields);
+      } catch (...) {
+        request.status = IDCARD_ERROR_INTERNAL;
+      }
+    }
+    if (status == IDCARD_OK) {
+      status = request.status;
+    }
+  }
+  return status;
+}
+
+const char* IDCardStatusMessage(IDCardStatus status) {
+  switch (status) {
+    case IDCARD_OK:
+      return "ok";
+    case IDCARD_ERROR_INVALID_ARGUMENT:
+      return "invalid argument";
+    case IDCARD_ERROR_MODEL_NOT_FOUND:
+      return "model file not found";
+    case IDCARD_ERROR_DECODE_FAILED:
+      return "image decode failed";
+    case IDCARD_ERROR_BUFFER_TOO_SMALL:
+      return "output buffer too small";
+    case IDCARD_ERROR_INTERNAL:
+      return "internal error";
+    case IDCARD_ERROR_MODEL_LOAD_FAILED:
+      return "model load failed";
+  }
+  return "unknown status";
+}
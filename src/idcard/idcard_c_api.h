@@ -0,0 +1,129 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#ifndef TUYUIDCARD_C_API_H_
+#define TUYUIDCARD_C_API_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "common/common.h"
+
+// C interface of the ID card reader, for embedding through FFI. An engine
+// owns a pool of workers and may be called from any number of threads at
+// once. No exception crosses these functions; failures are reported as
+// IDCardStatus. Pixels and encoded bytes passed in are used in place and
+// only need to stay valid for the duration of the call.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct IDCardEngine IDCardEngine;
+
+typedef enum IDCardStatus {
+  IDCARD_OK = 0,
+  IDCARD_ERROR_INVALID_ARGUMENT = 1,
+  IDCARD_ERROR_MODEL_NOT_FOUND = 2,
+  IDCARD_ERROR_DECODE_FAILED = 3,
+  // some fields or values did not fit, what fits is still written
+  IDCARD_ERROR_BUFFER_TOO_SMALL = 4,
+  IDCARD_ERROR_INTERNAL = 5,
+  // a model file exists but onnxruntime could not load it
+  IDCARD_ERROR_MODEL_LOAD_FAILED = 6
+} IDCardStatus;
+
+typedef enum IDCardSide {
+  // the side with the photo: name, gender, ethnicity, birth, address and
+  // id number
+  IDCARD_SIDE_HEAD = 0,
+  // the side with the national emblem: authority and validity
+  IDCARD_SIDE_EMBLEM = 1
+} IDCardSide;
+
+#define IDCARD_MAX_KEY_SIZE 32
+#define IDCARD_MAX_VALUE_SIZE 256
+// enough for every field of either side
+#define IDCARD_MAX_FIELDS 8
+
+// One recognized field, both strings are NUL terminated UTF-8. A value that
+// does not fit is cut at a character boundary.
+typedef struct IDCardField {
+  char key[IDCARD_MAX_KEY_SIZE];
+  char value[IDCARD_MAX_VALUE_SIZE];
+} IDCardField;
+
+// Options are versioned by struct_size, new fields are only ever appended.
+// A caller built against an older header passes a smaller struct_size and
+// the fields it does not know keep their defaults.
+typedef struct IDCardEngineOptions {
+  // sizeof(IDCardEngineOptions) of the caller, set by
+  // IDCardEngineOptionsInit
+  size_t struct_size;
+  // <= 0 uses one worker per hardware thread
+  int num_workers;
+  // onnxruntime threads of every session
+  int intra_op_num_threads;
+  // locate and warp the card before reading it, off by default
+  int rectify_card;
+  // where optimized models are cached, NULL disables the cache
+  const char* optimized_model_dir;
+} IDCardEngineOptions;
+
+// Fills the options with the defaults and sets struct_size.
+TUYUIDCARD_API void IDCardEngineOptionsInit(IDCardEngineOptions* options);
+
+// Loads the models and starts the workers. options may be NULL, a
+// struct_size this library does not know is an invalid argument.
+TUYUIDCARD_API IDCardStatus IDCardEngineCreate(
+    const char* det_model, const char* rec_model,
+    const IDCardEngineOptions* options, IDCardEngine** engine);
+// Waits for running requests and frees the engine, NULL is ignored.
+TUYUIDCARD_API void IDCardEngineDestroy(IDCardEngine* engine);
+
+// Reads a card from 8-bit BGR pixels, rows are stride bytes apart. The
+// pixels are not copied. Up to max_fields fields are written to fields and
+// their number to num_fields.
+TUYUIDCARD_API IDCardStatus IDCardProcessBGR(
+    IDCardEngine* engine, IDCardSide side, const uint8_t* pixels, int width,
+    int height, size_t stride, IDCardField* fields, size_t max_fields,
+    size_t* num_fields);
+
+// Reads a card from an encoded image (JPEG, PNG, ...). It is decoded on a
+// worker, JPEG at a reduced size close to what the models need.
+TUYUIDCARD_API IDCardStatus IDCardProcessEncoded(
+    IDCardEngine* engine, IDCardSide side, const uint8_t* data, size_t size,
+    IDCardField* fields, size_t max_fields, size_t* num_fields);
+
+// One image of a batch. Set either encoded/encoded_size or the BGR pixels;
+// fields/max_fields are the output buffer. num_fields and status are
+// written by IDCardProcessBatch.
+typedef struct IDCardRequest {
+  IDCardSide side;
+  const uint8_t* encoded;
+  size_t encoded_size;
+  const uint8_t* pixels;
+  int width;
+  int height;
+  size_t stride;
+  IDCardField* fields;
+  size_t max_fields;
+  size_t num_fields;
+  IDCardStatus status;
+} IDCardRequest;
+
+// Runs the requests on all workers of the engine and returns when every
+// one is done. Returns IDCARD_OK when all of them succeeded, otherwise the
+// status of the first failed request.
+TUYUIDCARD_API IDCardStatus IDCardProcessBatch(IDCardEngine* engine,
+                                               IDCardRequest* requests,
+                                               size_t count);
+
+// A static description of the status.
+TUYUIDCARD_API const char* IDCardStatusMessage(IDCardStatus status);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // TUYUIDCARD_C_API_H_
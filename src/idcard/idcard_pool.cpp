@@ -0,0 +1,157 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "idcard_pool.h"
+#include <cassert>
+#include <cstdio>
+#include <exception>
+#include <memory>
+
+IDCardOCRPool::IDCardOCRPool(const OrtApi* ort_api, OrtEnv* env,
+                             int num_workers, const IDCardConfig& config)
+    : ort_api_(ort_api),
+      env_(env),
+      num_workers_(num_workers),
+      config_(config),
+      num_ready_(0),
+      num_failed_(0),
+      stop_(false) {
+  if (num_workers_ <= 0) {
+    num_workers_ = std::max(1u, std::thread::hardware_concurrency());
+  }
+}
+
+IDCardOCRPool::~IDCardOCRPool() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_cond_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+bool IDCardOCRPool::InitModel(const std::string& det_model,
+                              const std::string& rec_model,
+                              const SessionConfig& config) {
+  assert(workers_.empty());
+  // every worker loads its own sessions so the models load in parallel
+  for (int i = 0; i < num_workers_; i++) {
+    workers_.emplace_back(&IDCardOCRPool::WorkerLoop, this, det_model,
+                          rec_model, config);
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ready_cond_.wait(
+        lock, [this] { return num_ready_ + num_failed_ == num_workers_; });
+    if (num_failed_ == 0) {
+      return true;
+    }
+    stop_ = true;
+  }
+  task_cond_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+  return false;
+}
+
+void IDCardOCRPool::WorkerLoop(const std::string& det_model,
+                               const std::string& rec_model,
+                               const SessionConfig& config) {
+  IDCardOCR idcard(ort_api_, env_, config_);
+  // a failure must not escape the thread, that would terminate the process
+  bool loaded = false;
+  try {
+    loaded = idcard.InitModel(det_model, rec_model, config);
+  } catch (const std::exception& e) {
+    fprintf(stderr, "worker failed to load the models: %s\n", e.what());
+  } catch (...) {
+    fprintf(stderr, "worker failed to load the models\n");
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (loaded) {
+      num_ready_++;
+    } else {
+      num_failed_++;
+    }
+  }
+  ready_cond_.notify_all();
+  if (!loaded) {
+    return;
+  }
+
+  while (true) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_cond_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+      // pending requests are still served on shutdown
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task(&idcard);
+  }
+}
+
+std::future<IDCardOCRPool::Infos> IDCardOCRPool::Submit(
+    const std::function<void(IDCardOCR*, Infos&)>& parse) {
+  assert(!workers_.empty());
+  // packaged_task is move only, std::function needs a copyable target
+  auto job = std::make_shared<std::packaged_task<Infos(IDCardOCR*)>>(
+      [parse](IDCardOCR* idcard) {
+        Infos infos;
+        parse(idcard, infos);
+        return infos;
+      });
+  std::future<Infos> result = job->get_future();
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    tasks_.emplace([job](IDCardOCR* idcard) { (*job)(idcard); });
+  }
+  task_cond_.notify_one();
+  return result;
+}
+
+std::future<IDCardOCRPool::Infos> IDCardOCRPool::SubmitHead(
+    const cv::Mat& image) {
+  return Submit([image](IDCardOCR* idcard, Infos& infos) {
+    idcard->ParseHead(image, infos);
+  });
+}
+
+std::future<IDCardOCRPool::Infos> IDCardOCRPool::SubmitEmblem(
+    const cv::Mat& image) {
+  return Submit([image](IDCardOCR* idcard, Infos& infos) {
+    idcard->ParseEmblem(image, infos);
+  });
+}
+
+std::future<IDCardOCRPool::Infos> IDCardOCRPool::SubmitHead(
+    const uint8_t* data, size_t size) {
+  return Submit([data, size](IDCardOCR* idcard, Infos& infos) {
+    idcard->ParseHead(data, size, infos);
+  });
+}
+
+std::future<IDCardOCRPool::Infos> IDCardOCRPool::SubmitEmblem(
+    const uint8_t* data, size_t size) {
+  return Submit([data, size](IDCardOCR* idcard, Infos& infos) {
+    idcard->ParseEmblem(data, size, infos);
+  });
+}
+
+void IDCardOCRPool::ParseHead(const cv::Mat& image, Infos& infos) {
+  infos = SubmitHead(image).get();
+}
+
+void IDCardOCRPool::ParseEmblem(const cv::Mat& image, Infos& infos) {
+  infos = SubmitEmblem(image).get();
+}
@@ -0,0 +1,69 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include "common/common.h"
+#include "idcard/idcard.h"
+
+// A pool of IDCardOCR workers sharing one OrtEnv. Every worker owns its own
+// detector/recognizer sessions and thread; requests may come from any thread
+// and are queued until a worker is idle.
+class TUYUIDCARD_API IDCardOCRPool {
+ public:
+  typedef std::vector<std::pair<std::string, std::string>> Infos;
+
+  // num_workers <= 0 uses one worker per hardware thread.
+  IDCardOCRPool(const OrtApi* ort_api, OrtEnv* env, int num_workers = 0,
+                const IDCardConfig& config = IDCardConfig());
+  ~IDCardOCRPool();
+
+  // Loads the models in every worker, returns when all of them are ready.
+  // Returns false and stops the workers when any of them failed to load.
+  bool InitModel(const std::string& det_model, const std::string& rec_model,
+                 const SessionConfig& config = SessionConfig());
+
+  // The image is shared, not copied; keep it unchanged until the future is
+  // ready.
+  std::future<Infos> SubmitHead(const cv::Mat& image);
+  std::future<Infos> SubmitEmblem(const cv::Mat& image);
+  // Encoded images are decoded on the worker. The bytes are not copied,
+  // keep them alive until the future is ready; infos is empty when they
+  // cannot be decoded.
+  std::future<Infos> SubmitHead(const uint8_t* data, size_t size);
+  std::future<Infos> SubmitEmblem(const uint8_t* data, size_t size);
+
+  // Blocking variants of the Submit calls.
+  void ParseHead(const cv::Mat& image, Infos& infos);
+  void ParseEmblem(const cv::Mat& image, Infos& infos);
+
+  int num_workers() const { return num_workers_; }
+
+ private:
+  typedef std::function<void(IDCardOCR*)> Task;
+
+  std::future<Infos> Submit(
+      const std::function<void(IDCardOCR*, Infos&)>& parse);
+  void WorkerLoop(const std::string& det_model, const std::string& rec_model,
+                  const SessionConfig& config);
+
+  const OrtApi* ort_api_;
+  OrtEnv* env_;
+  int num_workers_;
+  IDCardConfig config_;
+
+  std::vector<std::thread> workers_;
+  std::queue<Task> tasks_;
+  std::mutex mutex_;
+  std::condition_variable task_cond_;
+  std::condition_variable ready_cond_;
+  int num_ready_;
+  int num_failed_;
+  bool stop_;
+};
@@ -0,0 +1,94 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "image_decode.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+static int ReadBE16(const uint8_t* p) { return (p[0] << 8) | p[1]; }
+
+static uint32_t ReadBE32(const uint8_t* p) {
+  return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) |
+         (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+static bool ReadJpegSize(const uint8_t* data, size_t size, int* width,
+                         int* height) {
+  size_t pos = 2;
+  while (pos + 4 <= size) {
+    if (data[pos] != 0xFF) return false;
+    uint8_t marker = data[pos + 1];
+    // fill bytes before a marker
+    if (marker == 0xFF) {
+      pos++;
+      continue;
+    }
+    // standalone markers carry no length
+    if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+      pos += 2;
+      continue;
+    }
+    int length = ReadBE16(data + pos + 2);
+    if (length < 2) return false;
+    // SOF0..SOF15 except DHT (C4), JPG (C8) and DAC (CC)
+    if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 &&
+        marker != 0xC8 && marker != 0xCC) {
+      if (pos + 9 > size) return false;
+      *height = ReadBE16(data + pos + 5);
+      *width = ReadBE16(data + pos + 7);
+      return *width > 0 && *height > 0;
+    }
+    // the image data starts without a frame header
+    if (marker == 0xDA) return false;
+    pos += 2 + length;
+  }
+  return false;
+}
+
+bool ReadImageSize(const uint8_t* data, size_t size, int* width, int* height,
+                   bool* is_jpeg) {
+  static const uint8_t png_signature[8] = {0x89, 'P',  'N',  'G',
+                                           '\r', '\n', 0x1A, '\n'};
+  *is_jpeg = false;
+  if (data == NULL) return false;
+  if (size >= 4 && data[0] == 0xFF && data[1] == 0xD8) {
+    *is_jpeg = true;
+    return ReadJpegSize(data, size, width, height);
+  }
+  if (size >= 24 && memcmp(data, png_signature, 8) == 0 &&
+      memcmp(data + 12, "IHDR", 4) == 0) {
+    uint32_t w = ReadBE32(data + 16);
+    uint32_t h = ReadBE32(data + 20);
+    if (w == 0 || h == 0 || w > INT_MAX || h > INT_MAX) return false;
+    *width = int(w);
+    *height = int(h);
+    return true;
+  }
+  return false;
+}
+
+int ReducedDecodeScale(int width, int height, int min_long_side) {
+  int long_side = std::max(width, height);
+  int scale = 8;
+  while (scale > 1 && long_side / scale < min_long_side) {
+    scale /= 2;
+  }
+  return scale;
+}
+
+cv::Mat DecodeImage(const uint8_t* data, size_t size, int scale) {
+  if (data == NULL || size == 0 || size > INT_MAX) return cv::Mat();
+  int flags = cv::IMREAD_COLOR;
+  if (scale >= 8) {
+    flags = cv::IMREAD_REDUCED_COLOR_8;
+  } else if (scale >= 4) {
+    flags = cv::IMREAD_REDUCED_COLOR_4;
+  } else if (scale >= 2) {
+    flags = cv::IMREAD_REDUCED_COLOR_2;
+  }
+  // wraps the bytes, imdecode does not keep or modify them
+  cv::Mat buffer(1, int(size), CV_8UC1, const_cast<uint8_t*>(data));
+  return cv::imdecode(buffer, flags);
+}
@@ -0,0 +1,21 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// Reads the pixel size from a JPEG (SOF segment) or PNG (IHDR chunk) header
+// without decoding. Returns false for other formats or broken headers.
+bool ReadImageSize(const uint8_t* data, size_t size, int* width, int* height,
+                   bool* is_jpeg);
+
+// The largest JPEG reduction (1, 2, 4 or 8) that keeps the long side of a
+// width x height image at least min_long_side pixels.
+int ReducedDecodeScale(int width, int height, int min_long_side);
+
+// Decodes to BGR at 1/scale of the stored size. JPEG reduces during the
+// DCT, other formats are decoded at full size and then shrunk.
+cv::Mat DecodeImage(const uint8_t* data, size_t size, int scale);
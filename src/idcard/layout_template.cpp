@@ -0,0 +1,85 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "layout_template.h"
+#include "idcard/fields.h"
+
+const std::vector<FieldTemplate>& HeadTemplate() {
+  static const std::vector<FieldTemplate> fields = {
+      {kFieldName, 0.170f, 0.080f, 0.430f, 0.120f, 1},
+      {kFieldGender, 0.170f, 0.215f, 0.130f, 0.105f, 1},
+      {kFieldEthnicity, 0.390f, 0.215f, 0.230f, 0.105f, 1},
+      {kFieldBirth, 0.170f, 0.340f, 0.450f, 0.105f, 1},
+      {kFieldAddress, 0.170f, 0.465f, 0.460f, 0.300f, 3},
+      {kFieldIdNumber, 0.320f, 0.800f, 0.640f, 0.120f, 1},
+  };
+  return fields;
+}
+
+const std::vector<FieldTemplate>& EmblemTemplate() {
+  static const std::vector<FieldTemplate> fields = {
+      {kFieldAuthority, 0.385f, 0.705f, 0.550f, 0.105f, 1},
+      {kFieldValidity, 0.385f, 0.820f, 0.550f, 0.105f, 1},
+  };
+  return fields;
+}
+
+// Narrows a line region to its ink columns plus a margin. Returns an empty
+// rect when the region holds no text.
+static cv::Rect InkColumns(const cv::Mat& gray, const cv::Rect& roi) {
+  cv::Mat binary;
+  cv::threshold(gray(roi), binary, 0, 255,
+                cv::THRESH_BINARY_INV | cv::THRESH_OTSU);
+  cv::Mat column_ink;
+  cv::reduce(binary, column_ink, 0, cv::REDUCE_SUM, CV_32S);
+  // a column counts when at least two pixels are ink, which drops speckles
+  const int* ink = column_ink.ptr<int>(0);
+  int first = -1;
+  int last = -1;
+  for (int x = 0; x < roi.width; x++) {
+    if (ink[x] >= 2 * 255) {
+      if (first < 0) first = x;
+      last = x;
+    }
+  }
+  if (first < 0) {
+    return cv::Rect();
+  }
+  int margin = roi.height / 4;
+  first = std::max(0, first - margin);
+  last = std::min(roi.width - 1, last + margin);
+  return cv::Rect(roi.x + first, roi.y, last - first + 1, roi.height);
+}
+
+void CropTemplateLines(const cv::Mat& card,
+                       const std::vector<FieldTemplate>& fields,
+                       std::vector<TemplateLine>& lines) {
+  cv::Mat gray;
+  if (card.channels() == 1) {
+    gray = card;
+  } else if (card.channels() == 4) {
+    cv::cvtColor(card, gray, cv::COLOR_BGRA2GRAY);
+  } else {
+    cv::cvtColor(card, gray, cv::COLOR_BGR2GRAY);
+  }
+  cv::Rect card_rect(0, 0, card.cols, card.rows);
+  lines.clear();
+  for (size_t i = 0; i < fields.size(); i++) {
+    const FieldTemplate& field = fields[i];
+    float line_h = field.h / field.lines;
+    for (int k = 0; k < field.lines; k++) {
+      cv::Rect roi(int(field.x * card.cols),
+                   int((field.y + k * line_h) * card.rows),
+                   int(field.w * card.cols), int(line_h * card.rows));
+      roi &= card_rect;
+      if (roi.empty()) continue;
+      cv::Rect text_rect = InkColumns(gray, roi);
+      if (text_rect.empty()) continue;
+      TemplateLine line;
+      line.field = i;
+      line.image = card(text_rect);
+      lines.push_back(line);
+    }
+  }
+}
@@ -0,0 +1,34 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+// A field at a fixed place of the rectified card. The region is given in
+// fractions of the card width/height and is split into `lines` text lines
+// of equal height (the address spans up to three).
+struct FieldTemplate {
+  const char* key;
+  float x, y, w, h;
+  int lines;
+};
+
+// Field layout of the resident ID card, front (head) and back (emblem).
+const std::vector<FieldTemplate>& HeadTemplate();
+const std::vector<FieldTemplate>& EmblemTemplate();
+
+// A text line cut out of the card for one template field.
+struct TemplateLine {
+  int field;
+  cv::Mat image;
+};
+
+// Crops the text lines of every template field from a rectified card. The
+// line regions are narrowed to the columns that contain ink, so short
+// values give short crops; lines without ink are skipped.
+void CropTemplateLines(const cv::Mat& card,
+                       const std::vector<FieldTemplate>& fields,
+                       std::vector<TemplateLine>& lines);
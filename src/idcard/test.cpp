@@ -1,4 +1,6 @@
 #include <opencv2/opencv.hpp>
+#include <fstream>
+#include <iterator>
 #include "idcard.h"
 #include "onnxruntime_c_api.h"
 
@@ -15,10 +17,21 @@ int main(int argc, char* argv[]) {
   OrtEnv* env;
   g_ort->CreateEnv(ORT_LOGGING_LEVEL_WARNING, "idcard", &env);
   IDCardOCR idcard(g_ort, env);
-  idcard.InitModel(det_model_path, rec_model_path);
-  cv::Mat image = cv::imread(image_path);
+  if (!idcard.InitModel(det_model_path, rec_model_path)) {
+    return 1;
+  }
+  // pass the file bytes, the encoded path decodes at reduced size
+  std::ifstream file(image_path, std::ios::binary);
+  std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
   std::vector<std::pair<std::string, std::string>> infos;
-  idcard.ParseHead(image, infos);
+  if (!idcard.ParseHead(bytes.data(), bytes.size(), infos)) {
+    std::cout << "failed to decode " << image_path << std::endl;
+    return 1;
+  }
+  for (auto& info : infos) {
+    std::cout << info.first << ": " << info.second << std::endl;
+  }
 
   return 0;
 }
\ No newline at end of file
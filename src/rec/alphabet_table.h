@@ -0,0 +1,1129 @@
+﻿// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+// Generated by gen_alphabet_table.py from alphabet.txt, do not edit.
+
+#pragma once
+#include <cstdint>
+
+constexpr int kAlphabetSize = 6845;
+
+// the UTF-8 bytes of every character back to back, not NUL separated
+constexpr char kAlphabetData[] =
+    " " "!" "\"" "#" "$" "%" "&" "'" "(" ")" "*" "+" "," "-" "." "/"
+    "0" "1" "2" "3" "4" "5" "6" "7" "8" "9" ":" ";" "<" "=" ">" "?"
+    "@" "A" "B" "C" "D" "E" "F" "G" "H" "I" "J" "K" "L" "M" "N" "O"
+    "P" "Q" "R" "S" "T" "U" "V" "W" "X" "Y" "Z" "[" "\\" "]" "^" "_"
+    "`" "a" "b" "c" "d" "e" "f" "g" "h" "i" "j" "k" "l" "m" "n" "o"
+    "p" "q" "r" "s" "t" "u" "v" "w" "x" "y" "z" "{" "|" "}" "~" "°"
+    "±" "·" "×" "à" "é" "÷" "ü" "α" "β" "О" "П" "Р" "–" "—" "―" "‘"
+    "’" "“" "”" "…" "‰" "′" "※" "℃" "Ⅰ" "Ⅱ" "Ⅲ" "Ⅳ" "→" "↓" "∈" "√"
+    "∩" "∵" "∶" "≠" "≤" "≥" "①" "②" "③" "④" "⑤" "⑥" "⑦" "⑧" "⑨" "⑩"
+    "⑴" "⑵" "⑶" "⑾" "⑿" "⒀" "⒂" "⒃" "⒄" "⒅" "⒆" "⒈" "⒉" "⒊" "─" "━"
+    "│" "┌" "┐" "╱" "■" "□" "▲" "△" "◆" "◇" "○" "◎" "●" "★" "☆" "　"
+    "、" "。" "〇" "〈" "〉" "《" "》" "「" "」" "『" "』" "【" "】" "〔" "〕" "て"
+    "な" "㘰" "㘵" "㙍" "㙟" "䓣" "䶮" "一" "丁" "七" "万" "丈" "三" "上" "下" "不"
+    "与" "丐" "丑" "专" "且" "丕" "世" "丘" "丙" "业" "丛" "东" "丝" "丞" "丢" "两"
+    "严" "丧" "个" "丫" "中" "丰" "串" "临" "丸" "丹" "为" "主" "丽" "举" "乂" "乃"
+    "久" "么" "义" "之" "乌" "乍" "乎" "乏" "乐" "乒" "乓" "乔" "乖" "乘" "乙" "乜"
+    "九" "乞" "也" "习" "乡" "书" "乩" "买" "乱" "乳" "乸" "乾" "了" "予" "争" "事"
+    "二" "于" "亏" "云" "互" "亓" "五" "井" "亘" "亚" "些" "亟" "亡" "亢" "交" "亥"
+    "亦" "产" "亨" "亩" "享" "京" "亭" "亮" "亲" "亳" "亵" "亶" "人" "亿" "什" "仁"
+    "仂" "仃" "仄" "仅" "仆" "仇" "仉" "今" "介" "仍" "从" "仑" "仓" "仔" "仕" "他"
+    "仗" "付" "仙" "仚" "仝" "仞" "仟" "仡" "代" "令" "以" "仨" "仪" "仫" "们" "仰"
+    "仲" "仵" "件" "价" "任" "份" "仿" "企" "伉" "伊" "伍" "伎" "伏" "伐" "休" "伕"
+    "众" "优" "伙" "会" "伛" "伞" "伟" "传" "伢" "伤" "伦" "伧" "伪" "伫" "伯" "估"
+    "伲" "伴" "伶" "伸" "伺" "伻" "似" "伽" "伾" "佀" "佃" "但" "佈" "位" "低" "住"
+    "佐" "佑" "体" "何" "佗" "佘" "余" "佚" "佛" "作" "佝" "佞" "佟" "你" "佣" "佤"
+    "佧" "佩" "佬" "佯" "佰" "佳" "佴" "佶" "佺" "佻" "佼" "佾" "使" "侃" "侄" "侈"
+    "侉" "例" "侍" "侏" "侑" "侔" "侗" "供" "依" "侠" "侣" "侥" "侦" "侧" "侨" "侩"
+    "侪" "侬" "侮" "侯" "侴" "侵" "便" "促" "俄" "俅" "俊" "俍" "俎" "俏" "俐" "俑"
+    "俗" "俘" "俚" "俛" "保" "俞" "俟" "信" "俣" "俤" "俦" "俨" "俩" "俪" "俬" "俭"
+    "修" "俯" "俱" "俳" "俵" "俶" "俸" "俺" "俾" "倍" "倏" "倒" "倓" "倔" "倖" "倘"
+    "候" "倚" "倜" "倞" "借" "倡" "倢" "倦" "倨" "倩" "倪" "倬" "倭" "倮" "倴" "债"
+    "值" "倾" "偃" "假" "偈" "偌" "偎" "偏" "偕" "做" "停" "健" "偰" "偲" "偶" "偷"
+    "偻" "偿" "傀" "傅" "傈" "傍" "傑" "傕" "傢" "傣" "傥" "傧" "储" "傩" "催" "傲"
+    "傻" "像" "僖" "僚" "僦" "僧" "僭" "僮" "僰" "僳" "僵" "價" "僻" "儀" "億" "儆"
+    "儇" "儋" "儒" "儡" "儿" "兀" "允" "元" "兄" "充" "兆" "先" "光" "克" "免" "兑"
+    "兒" "兔" "兕" "兖" "党" "兜" "兢" "入" "內" "全" "八" "公" "六" "兮" "兰" "共"
+    "关" "兴" "兵" "其" "具" "典" "兹" "养" "兼" "兽" "冀" "冁" "内" "冈" "冉" "册"
+    "再" "冏" "冑" "冒" "冕" "冗" "写" "冚" "军" "农" "冠" "冢" "冤" "冥" "冬" "冮"
+    "冯" "冰" "冲" "决" "况" "冶" "冷" "冻" "冼" "冽" "净" "凃" "凄" "准" "凇" "凉"
+    "凋" "凌" "凎" "减" "凑" "凛" "凝" "几" "凡" "凤" "凫" "凭" "凯" "凰" "凱" "凳"
+    "凶" "凸" "凹" "出" "击" "凼" "函" "凿" "刀" "刁" "刃" "分" "切" "刈" "刊" "刍"
+    "刎" "刑" "划" "刓" "刖" "列" "刘" "则" "刚" "创" "初" "删" "判" "刨" "利" "别"
+    "刭" "刮" "到" "刳" "制" "刷" "券" "刹" "刺" "刻" "刽" "剀" "剁" "剂" "剃" "剅"
+    "削" "剌" "前" "剎" "剐" "剑" "剔" "剖" "剜" "剡" "剥" "剧" "剩" "剪" "副" "割"
+    "剽" "剿" "劈" "劓" "劙" "力" "劝" "办" "功" "加" "务" "劢" "劣" "劦" "动" "助"
+    "努" "劫" "劬" "劭" "励" "劲" "劳" "劵" "劼" "劾" "势" "勃" "勇" "勉" "勋" "勍"
+    "勐" "勒" "勖" "勘" "募" "勤" "勰" "勺" "勾" "勿" "匀" "包" "匆" "匈" "匍" "匏"
+    "匐" "匕" "化" "北" "匙" "匝" "匠" "匡" "匣" "匪" "匮" "匳" "匹" "区" "医" "匽"
+    "匾" "匿" "區" "十" "千" "卅" "升" "午" "卉" "半" "华" "协" "卑" "卒" "卓" "单"
+    "卖" "南" "博" "卜" "卞" "占" "卡" "卢" "卤" "卦" "卧" "卫" "卬" "卮" "卯" "印"
+    "危" "即" "却" "卵" "卷" "卸" "卺" "卿" "厂" "厄" "厅" "历" "厉" "压" "厌" "厍"
+    "厐" "厕" "厘" "厚" "厝" "原" "厢" "厥" "厦" "厨" "厩" "厮" "厶" "去" "县" "叁"
+    "参" "又" "叉" "及" "友" "双" "反" "发" "叔" "取" "受" "变" "叙" "叛" "叟" "叠"
+    "叡" "口" "古" "句" "另" "叨" "叩" "只" "叫" "召" "叭" "叮" "可" "台" "叱" "史"
+    "右" "叵" "叶" "号" "司" "叹" "叻" "叼" "叽" "吁" "吃" "各" "吆" "合" "吉" "吊"
+    "同" "名" "后" "吏" "吐" "向" "吒" "吓" "吕" "吗" "君" "吝" "吞" "吟" "吠" "否"
+    "吧" "吨" "吩" "含" "听" "吭" "吮" "启" "吱" "吴" "吵" "吸" "吹" "吻" "吼" "吾"
+    "呀" "呂" "呃" "呆" "呈" "告" "呐" "呓" "呕" "呗" "员" "呙" "呛" "呜" "呢" "呤"
+    "呦" "周" "呱" "味" "呵" "呶" "呷" "呻" "呼" "命" "咀" "咂" "咄" "咆" "咋" "和"
+    "咎" "咏" "咐" "咒" "咔" "咕" "咖" "咘" "咙" "咚" "咛" "咡" "咣" "咤" "咦" "咧"
+    "咨" "咪" "咫" "咬" "咯" "咱" "咳" "咸" "咻" "咽" "咿" "哀" "品" "哂" "哄" "哆"
+    "哇" "哈" "哉" "哌" "响" "哎" "哏" "哑" "哓" "哗" "哙" "哝" "哟" "哥" "哦" "哧"
+    "哨" "哩" "哪" "哭" "哮" "哲" "哺" "哼" "哽" "哿" "唁" "唆" "唇" "唉" "唏" "唐"
+    "唑" "唔" "唕" "唛" "唠" "唢" "唤" "唧" "唬" "售" "唯" "唱" "唳" "唶" "唸" "唾"
+    "唿" "啁" "啃" "啄" "商" "啊" "啐" "啓" "啕" "啖" "啜" "啟" "啡" "啤" "啥" "啦"
+    "啧" "啪" "啬" "啮" "啰" "啶" "啸" "啻" "啼" "啾" "喀" "喁" "喂" "喃" "善" "喆"
+    "喇" "喉" "喊" "喋" "喏" "喑" "喔" "喘" "喙" "喜" "喝" "喟" "喧" "喱" "喳" "喷"
+    "喹" "喻" "喽" "喾" "嗄" "嗅" "嗌" "嗑" "嗒" "嗓" "嗔" "嗖" "嗛" "嗜" "嗝" "嗟"
+    "嗡" "嗣" "嗤" "嗥" "嗦" "嗨" "嗪" "嗫" "嗯" "嗲" "嗳" "嗷" "嗽" "嗾" "嘀" "嘈"
+    "嘉" "嘌" "嘎" "嘘" "嘛" "嘟" "嘡" "嘤" "嘭" "嘱" "嘲" "嘴" "嘶" "嘹" "嘻" "嘿"
+    "噉" "噌" "噎" "噔" "噗" "噙" "噜" "噢" "噤" "器" "噩" "噪" "噫" "噬" "噭" "噱"
+    "噶" "噻" "嚅" "嚎" "嚏" "嚓" "嚣" "嚬" "嚷" "嚼" "囊" "囔" "囗" "囚" "四" "囝"
+    "回" "因" "囡" "团" "囤" "囫" "园" "困" "囱" "围" "囵" "囷" "囹" "固" "国" "图"
+    "囿" "圃" "圄" "圆" "圈" "圉" "國" "圐" "園" "圓" "團" "圙" "圜" "土" "圣" "在"
+    "圩" "圪" "圭" "圯" "地" "圳" "圹" "场" "圻" "圾" "址" "坁" "坂" "均" "坉" "坊"
+    "坌" "坍" "坎" "坏" "坐" "坑" "块" "坚" "坛" "坜" "坝" "坞" "坟" "坠" "坡" "坣"
+    "坤" "坦" "坨" "坪" "坬" "坭" "坮" "坯" "坳" "坵" "坷" "坻" "坼" "坽" "垂" "垃"
+    "垄" "垅" "垆" "垇" "垈" "型" "垌" "垒" "垓" "垕" "垚" "垛" "垝" "垞" "垟" "垠"
+    "垡" "垢" "垣" "垤" "垦" "垧" "垩" "垫" "垭" "垮" "垯" "垱" "垲" "垴" "垵" "垸"
+    "垾" "垿" "埂" "埃" "埇" "埋" "埌" "城" "埒" "埔" "埕" "埗" "埙" "埚" "埜" "埝"
+    "域" "埠" "埡" "埤" "埩" "埪" "埫" "埭" "埸" "培" "基" "埼" "堀" "堂" "堃" "堆"
+    "堇" "堉" "堋" "堌" "堍" "堎" "堑" "堕" "堘" "堙" "堞" "堠" "堡" "堤" "堪" "堯"
+    "堰" "報" "場" "堵" "堼" "堽" "塄" "塅" "塆" "塌" "塍" "塑" "塔" "塘" "塚" "塝"
+    "塞" "塥" "塨" "填" "塬" "塭" "塱" "塽" "塾" "墀" "墁" "境" "墅" "墈" "墉" "墓"
+    "墕" "墘" "墙" "增" "墟" "墠" "墨" "墩" "壁" "壅" "壆" "壑" "壕" "壘" "壤" "士"
+    "壬" "壮" "声" "壳" "壶" "壹" "壽" "处" "夆" "备" "复" "夏" "夔" "夕" "外" "夙"
+    "多" "夜" "够" "夤" "夥" "大" "天" "太" "夫" "夭" "央" "夯" "失" "头" "夷" "夸"
+    "夹" "夺" "夼" "奀" "奁" "奂" "奄" "奇" "奈" "奉" "奋" "奎" "奏" "契" "奓" "奔"
+    "奕" "奖" "套" "奘" "奚" "奠" "奡" "奢" "奥" "奭" "女" "奴" "奶" "奸" "她" "好"
+    "妁" "如" "妃" "妄" "妆" "妇" "妈" "妊" "妍" "妒" "妓" "妖" "妗" "妙" "妞" "妤"
+    "妥" "妨" "妩" "妪" "妮" "妲" "妳" "妹" "妻" "妾" "姁" "姆" "姊" "始" "姐" "姑"
+    "姒" "姓" "委" "姗" "姚" "姜" "姝" "姣" "姥" "姨" "姬" "姮" "姹" "姻" "姿" "威"
+    "娃" "娄" "娅" "娆" "娇" "娈" "娉" "娌" "娑" "娒" "娓" "娘" "娜" "娟" "娠" "娡"
+    "娣" "娥" "娩" "娱" "娲" "娴" "娶" "娼" "婀" "婆" "婉" "婊" "婍" "婕" "婚" "婢"
+    "婧" "婪" "婳" "婴" "婵" "婶" "婷" "婺" "婻" "婼" "婿" "媒" "媖" "媗" "媚" "媛"
+    "媞" "媪" "媲" "媳" "媵" "媸" "媾" "嫁" "嫂" "嫄" "嫉" "嫌" "嫒" "嫔" "嫖" "嫘"
+    "嫚" "嫜" "嫡" "嫣" "嫦" "嫩" "嫪" "嫱" "嬉" "嬌" "嬖" "嬗" "嬛" "嬴" "嬿" "孀"
+    "子" "孑" "孔" "孕" "字" "存" "孙" "孚" "孛" "孜" "孝" "孟" "孢" "季" "孤" "孥"
+    "学" "孩" "孪" "孬" "孰" "孱" "孳" "孵" "孺" "孽" "宁" "它" "宅" "宇" "守" "安"
+    "宋" "完" "宏" "宓" "宕" "宗" "官" "宙" "定" "宛" "宜" "宝" "实" "宠" "审" "客"
+    "宣" "室" "宥" "宦" "宪" "宫" "宬" "宰" "害" "宴" "宵" "家" "宸" "容" "宽" "宾"
+    "宿" "寀" "寂" "寄" "寅" "密" "寇" "富" "寐" "寒" "寓" "寖" "寘" "寝" "寞" "察"
+    "寡" "寤" "寥" "寧" "寨" "寮" "寰" "寸" "对" "寺" "寻" "导" "寿" "封" "射" "将"
+    "尉" "尊" "對" "小" "少" "尔" "尕" "尖" "尘" "尚" "尝" "尤" "尧" "尬" "就" "尴"
+    "尸" "尹" "尺" "尻" "尼" "尽" "尾" "尿" "局" "屁" "层" "居" "屈" "屉" "届" "屋"
+    "屎" "屏" "屐" "屑" "展" "属" "屠" "屡" "屣" "層" "履" "屦" "屯" "山" "屲" "屹"
+    "屺" "屾" "屿" "岁" "岂" "岈" "岌" "岐" "岑" "岔" "岕" "岖" "岗" "岘" "岙" "岚"
+    "岛" "岜" "岞" "岢" "岣" "岩" "岫" "岬" "岭" "岱" "岳" "岵" "岷" "岸" "岺" "岽"
+    "岿" "峁" "峃" "峄" "峇" "峋" "峒" "峗" "峘" "峙" "峡" "峣" "峤" "峥" "峦" "峨"
+    "峪" "峭" "峯" "峰" "峻" "崀" "崂" "崃" "崆" "崇" "崎" "崑" "崔" "崖" "崗" "崙"
+    "崚" "崛" "崞" "崟" "崤" "崧" "崩" "崭" "崮" "崯" "崴" "崽" "崾" "嵅" "嵇" "嵊"
+    "嵋" "嵌" "嵖" "嵘" "嵚" "嵛" "嵝" "嵩" "嵬" "嵯" "嵿" "嶂" "嶍" "嶒" "嶙" "嶚"
+    "嶝" "嶷" "嶺" "巅" "巉" "巍" "川" "州" "巡" "巢" "工" "左" "巧" "巨" "巩" "巫"
+    "差" "己" "已" "巳" "巴" "巷" "巽" "巾" "巿" "币" "市" "布" "帅" "帆" "师" "希"
+    "帏" "帐" "帑" "帔" "帕" "帖" "帘" "帚" "帛" "帜" "帝" "带" "帧" "帨" "席" "帮"
+    "帷" "常" "帼" "帽" "幂" "幄" "幅" "幌" "幔" "幕" "幛" "幞" "幡" "幢" "干" "平"
+    "年" "并" "幸" "幺" "幻" "幼" "幽" "广" "庄" "庆" "庇" "床" "序" "庐" "庑" "库"
+    "应" "底" "庖" "店" "庙" "庚" "府" "庞" "废" "庠" "庥" "度" "座" "庭" "庵" "庶"
+    "康" "庸" "庹" "庾" "廉" "廊" "廒" "廓" "廖" "廛" "廣" "廨" "廪" "延" "廷" "建"
+    "廿" "开" "弁" "异" "弃" "弄" "弇" "弈" "弊" "弋" "式" "弑" "弓" "引" "弗" "弘"
+    "弛" "弟" "张" "弢" "弥" "弦" "弧" "弨" "弩" "弭" "弯" "弱" "張" "弶" "弹" "强"
+    "弼" "彀" "彊" "彐" "归" "当" "录" "彗" "彘" "彝" "形" "彤" "彦" "彧" "彩" "彪"
+    "彬" "彭" "彰" "影" "彷" "役" "彻" "彼" "彿" "往" "征" "徂" "径" "待" "徇" "很"
+    "徉" "徊" "律" "後" "徐" "徒" "徕" "得" "徘" "徙" "徜" "御" "徨" "循" "徭" "微"
+    "徳" "徵" "德" "徼" "徽" "心" "必" "忆" "忌" "忍" "忏" "忐" "忑" "忒" "忖" "志"
+    "忘" "忙" "忝" "忞" "忠" "忡" "忤" "忧" "忪" "快" "忱" "念" "忻" "忽" "忿" "怀"
+    "态" "怂" "怅" "怆" "怍" "怎" "怏" "怒" "怔" "怕" "怖" "怙" "怛" "怜" "思" "怠"
+    "怡" "急" "怦" "性" "怨" "怪" "怫" "怯" "怵" "总" "怼" "怿" "恂" "恃" "恋" "恍"
+    "恐" "恒" "恕" "恙" "恚" "恝" "恢" "恣" "恤" "恨" "恩" "恪" "恫" "恬" "恭" "息"
+    "恰" "恳" "恶" "恸" "恹" "恺" "恻" "恼" "恽" "恿" "悃" "悄" "悅" "悉" "悌" "悍"
+    "悒" "悔" "悖" "悚" "悝" "悞" "悟" "悠" "患" "悦" "您" "悫" "悬" "悭" "悯" "悲"
+    "悴" "悸" "悻" "悼" "情" "惆" "惇" "惊" "惋" "惑" "惕" "惘" "惚" "惜" "惟" "惠"
+    "惦" "惧" "惨" "惩" "惫" "惬" "惭" "惮" "惯" "惰" "想" "惴" "惶" "惹" "惺" "愀"
+    "愁" "愆" "愈" "愉" "愍" "愎" "意" "愔" "愕" "愚" "愛" "感" "愠" "愣" "愤" "愦"
+    "愧" "愫" "愬" "愷" "愿" "慈" "慊" "慌" "慎" "慑" "慕" "慙" "慜" "慢" "慧" "慨"
+    "慰" "慵" "慷" "憋" "憎" "憔" "憧" "憨" "憩" "憬" "憶" "憾" "懂" "懈" "懊" "懋"
+    "懑" "懒" "懜" "懦" "懵" "懿" "戆" "戈" "戊" "戌" "戍" "戎" "戏" "成" "我" "戒"
+    "戕" "或" "戗" "战" "戚" "戛" "戟" "戡" "戢" "戥" "截" "戬" "戮" "戳" "戴" "户"
+    "戾" "房" "所" "扁" "扃" "扆" "扇" "扈" "扉" "手" "扌" "才" "扎" "扑" "扒" "打"
+    "扔" "托" "扛" "扞" "扢" "扣" "执" "扩" "扪" "扫" "扬" "扭" "扮" "扯" "扰" "扳"
+    "扶" "批" "扼" "找" "承" "技" "抄" "抉" "把" "抑" "抒" "抓" "投" "抖" "抗" "折"
+    "抚" "抛" "抟" "抠" "抡" "抢" "护" "报" "抨" "披" "抬" "抱" "抵" "抹" "抻" "押"
+    "抽" "抿" "拂" "拄" "担" "拆" "拇" "拈" "拉" "拊" "拌" "拍" "拎" "拐" "拑" "拒"
+    "拓" "拔" "拖" "拗" "拘" "拙" "拚" "招" "拜" "拟" "拢" "拣" "拥" "拦" "拧" "拨"
+    "择" "括" "拭" "拮" "拯" "拱" "拳" "拴" "拷" "拼" "拽" "拾" "拿" "持" "挂" "指"
+    "挈" "按" "挎" "挑" "挖" "挚" "挛" "挝" "挞" "挟" "挠" "挡" "挣" "挤" "挥" "挨"
+    "挪" "挫" "振" "挹" "挺" "挽" "捂" "捅" "捆" "捉" "捋" "捌" "捍" "捎" "捏" "捐"
+    "捕" "捞" "损" "捡" "换" "捣" "捧" "捭" "据" "捱" "捶" "捷" "捺" "捻" "捽" "掀"
+    "掂" "掇" "授" "掉" "掌" "掏" "掐" "排" "掖" "掘" "掛" "掠" "探" "掣" "接" "控"
+    "推" "掩" "措" "掬" "掰" "掳" "掷" "掺" "掼" "掾" "揄" "揆" "揉" "揍" "描" "提"
+    "插" "揖" "揜" "握" "揣" "揩" "揪" "揭" "援" "揶" "揽" "搀" "搁" "搂" "搅" "搌"
+    "搏" "搐" "搒" "搓" "搔" "搜" "搞" "搠" "搢" "搪" "搬" "搭" "搴" "携" "搽" "摁"
+    "摄" "摆" "摇" "摈" "摊" "摒" "摔" "摘" "摞" "摧" "摩" "摸" "摹" "撂" "撇" "撑"
+    "撒" "撕" "撖" "撝" "撞" "撤" "撩" "撬" "播" "撮" "撰" "撵" "撷" "撺" "撼" "擀"
+    "擂" "擅" "操" "擎" "擒" "擘" "擞" "擢" "擦" "攀" "攒" "攘" "攥" "攫" "支" "收"
+    "攸" "改" "攻" "放" "政" "故" "效" "敉" "敌" "敏" "救" "敕" "敖" "教" "敛" "敝"
+    "敞" "敢" "散" "敦" "敬" "数" "敲" "整" "敷" "文" "斋" "斌" "斐" "斑" "斓" "斗"
+    "料" "斛" "斜" "斟" "斡" "斤" "斥" "斧" "斩" "斫" "断" "斯" "新" "斲" "方" "於"
+    "施" "旁" "旃" "旄" "旅" "旆" "旋" "旌" "旎" "族" "旒" "旖" "旗" "无" "既" "日"
+    "旦" "旧" "旨" "早" "旬" "旭" "旮" "旯" "旱" "旴" "旵" "时" "旷" "旸" "旺" "旻"
+    "旼" "昀" "昂" "昃" "昆" "昇" "昉" "昊" "昌" "明" "昏" "易" "昔" "昕" "昙" "昝"
+    "昞" "星" "映" "春" "昧" "昨" "昫" "昭" "是" "昰" "昱" "昳" "昴" "昵" "昶" "昺"
+    "昼" "显" "晁" "晃" "晅" "晉" "晋" "晌" "晏" "晒" "晓" "晔" "晕" "晖" "晗" "晚"
+    "晛" "晞" "晟" "晡" "晢" "晤" "晦" "晧" "晨" "普" "景" "晰" "晴" "晶" "晸" "晹"
+    "智" "晾" "暂" "暄" "暇" "暐" "暑" "暕" "暖" "暗" "暘" "暠" "暧" "暨" "暮" "暲"
+    "暴" "暹" "暾" "曈" "曌" "曙" "曚" "曛" "曜" "曝" "曦" "曩" "曰" "曲" "曳" "更"
+    "曷" "書" "曹" "曼" "曾" "替" "最" "朂" "會" "月" "有" "朋" "服" "朐" "朔" "朕"
+    "朗" "望" "朝" "期" "朦" "木" "未" "末" "本" "札" "术" "朱" "朴" "朵" "机" "朽"
+    "杀" "杂" "权" "杆" "杈" "杉" "杌" "李" "杏" "材" "村" "杓" "杖" "杜" "杞" "束"
+    "杠" "条" "来" "杨" "杪" "杭" "杯" "杰" "東" "杲" "杳" "杵" "杷" "杼" "松" "板"
+    "极" "构" "枇" "枉" "枋" "析" "枕" "林" "枘" "枚" "果" "枝" "枞" "枢" "枣" "枥"
+    "枧" "枨" "枪" "枫" "枭" "枯" "枰" "枳" "枵" "架" "枷" "枸" "枹" "柃" "柄" "柈"
+    "柏" "某" "柑" "柒" "染" "柔" "柘" "柚" "柜" "柞" "柠" "柢" "查" "柩" "柬" "柯"
+    "柰" "柱" "柳" "柴" "柽" "柿" "栀" "栅" "标" "栈" "栉" "栊" "栋" "栎" "栏" "树"
+    "栒" "栓" "栖" "栗" "栟" "校" "栢" "栩" "株" "栲" "栳" "样" "核" "根" "格" "栽"
+    "栾" "栿" "桀" "桁" "桂" "桃" "桄" "桅" "框" "案" "桉" "桌" "桎" "桐" "桑" "桓"
+    "桔" "桠" "桡" "桢" "档" "桤" "桥" "桦" "桧" "桨" "桩" "桶" "桷" "梁" "梃" "梅"
+    "梆" "梏" "梓" "梗" "梢" "梦" "梧" "梨" "梭" "梯" "械" "梳" "梵" "梽" "检" "棂"
+    "棉" "棋" "棍" "棐" "棒" "棓" "棕" "棘" "棚" "棟" "棠" "棡" "棣" "棪" "森" "棰"
+    "棱" "棵" "棹" "棺" "棽" "椀" "椁" "椅" "椋" "植" "椎" "椐" "椑" "椒" "椟" "椭"
+    "椰" "椴" "椹" "椽" "椿" "楂" "楊" "楔" "楗" "楚" "楝" "楞" "楠" "楣" "楦" "楫"
+    "楮" "楷" "楸" "楹" "楼" "榀" "概" "榃" "榄" "榅" "榆" "榇" "榈" "榉" "榍" "榔"
+    "榕" "榛" "榜" "榧" "榨" "榫" "榭" "榮" "榱" "榴" "榷" "榻" "榼" "槁" "槃" "槊"
+    "槌" "槎" "槐" "槑" "槓" "槚" "槛" "槟" "槺" "槽" "槿" "樊" "樑" "樓" "樗" "樘"
+    "標" "樟" "模" "樨" "横" "樯" "樱" "樵" "樽" "樾" "橄" "橇" "橋" "橐" "橘" "橙"
+    "橡" "橦" "橫" "橱" "橹" "檀" "檄" "檐" "檑" "檔" "檗" "檟" "檠" "檢" "檩" "檬"
+    "櫃" "欠" "次" "欢" "欣" "欤" "欧" "欲" "欷" "欺" "欻" "款" "歆" "歇" "歉" "歌"
+    "歔" "歘" "歙" "止" "正" "此" "步" "武" "歧" "歪" "歹" "死" "歼" "殁" "殂" "殃"
+    "殄" "殆" "殇" "殉" "殊" "残" "殒" "殓" "殖" "殚" "殛" "殡" "殪" "殳" "殴" "段"
+    "殷" "殽" "殿" "毁" "毂" "毅" "毋" "母" "每" "毒" "毓" "比" "毕" "毗" "毙" "毛"
+    "毡" "毫" "毯" "毳" "氅" "氆" "氇" "氏" "氐" "民" "氓" "气" "氖" "氙" "氛" "氟"
+    "氡" "氢" "氤" "氦" "氧" "氨" "氩" "氮" "氯" "氰" "氲" "水" "永" "氹" "氽" "氾"
+    "氿" "汀" "汁" "求" "汇" "汈" "汉" "汊" "汎" "汐" "汔" "汕" "汗" "汛" "汜" "汝"
+    "汞" "江" "池" "污" "汤" "汨" "汩" "汪" "汫" "汭" "汰" "汲" "汴" "汶" "汹" "汽"
+    "汾" "沁" "沂" "沃" "沄" "沅" "沆" "沈" "沉" "沌" "沐" "沓" "沔" "沙" "沚" "沛"
+    "沟" "没" "沣" "沥" "沦" "沧" "沨" "沩" "沪" "沫" "沬" "沭" "沮" "沱" "河" "沸"
+    "油" "沺" "治" "沼" "沽" "沾" "沿" "泂" "泃" "泄" "泅" "泉" "泊" "泌" "泐" "泒"
+    "泓" "泔" "法" "泖" "泗" "泛" "泞" "泠" "泡" "波" "泣" "泥" "注" "泪" "泫" "泮"
+    "泯" "泰" "泱" "泳" "泵" "泷" "泸" "泺" "泻" "泼" "泽" "泾" "洁" "洄" "洇" "洈"
+    "洋" "洌" "洎" "洑" "洒" "洗" "洙" "洛" "洞" "洟" "洢" "洣" "津" "洧" "洩" "洪"
+    "洮" "洱" "洲" "洳" "洴" "洵" "洸" "洹" "洺" "活" "洼" "洽" "派" "流" "浃" "浅"
+    "浆" "浇" "浈" "浉" "浊" "测" "浍" "济" "浏" "浐" "浑" "浒" "浓" "浔" "浙" "浚"
+    "浛" "浜" "浞" "浠" "浡" "浣" "浥" "浦" "浩" "浪" "浬" "浮" "浯" "浰" "浴" "海"
+    "浸" "浼" "涂" "涅" "消" "涉" "涌" "涎" "涓" "涔" "涕" "涛" "涝" "涞" "涟" "涠"
+    "涡" "涣" "涤" "润" "涧" "涨" "涩" "涪" "涮" "涯" "液" "涴" "涵" "涸" "涿" "淀"
+    "淄" "淅" "淆" "淇" "淋" "淌" "淏" "淑" "淖" "淘" "淙" "淝" "淞" "淠" "淡" "淤"
+    "淦" "淩" "淫" "淬" "淮" "淯" "淰" "深" "淳" "混" "淹" "添" "淼" "清" "渊" "渌"
+    "渍" "渎" "渐" "渑" "渔" "渖" "渗" "渚" "渝" "渟" "渠" "渡" "渣" "渤" "渥" "温"
+    "測" "渭" "港" "渲" "渴" "游" "渺" "湃" "湄" "湉" "湍" "湎" "湑" "湓" "湔" "湖"
+    "湘" "湛" "湜" "湟" "湦" "湧" "湫" "湮" "湲" "湴" "湾" "湿" "溁" "溃" "溅" "溆"
+    "溇" "溉" "溍" "溏" "源" "溜" "溟" "溢" "溥" "溦" "溧" "溪" "溫" "溯" "溱" "溲"
+    "溴" "溶" "溷" "溺" "滁" "滂" "滆" "滇" "滈" "滉" "滋" "滏" "滑" "滓" "滔" "滕"
+    "滘" "滚" "滞" "滟" "滠" "满" "滢" "滤" "滥" "滦" "滧" "滨" "滩" "滴" "滹" "漂"
+    "漆" "漈" "漉" "漍" "漏" "漓" "演" "漕" "漖" "漠" "漩" "漪" "漫" "漭" "漯" "漱"
+    "漳" "漴" "漷" "漹" "漾" "潆" "潇" "潋" "潍" "潘" "潜" "潞" "潢" "潤" "潦" "潭"
+    "潮" "潴" "潸" "潺" "潼" "澄" "澈" "澉" "澋" "澌" "澍" "澎" "澔" "澛" "澜" "澡"
+    "澥" "澧" "澳" "澹" "激" "濂" "濉" "濑" "濒" "濛" "濞" "濠" "濡" "濬" "濮" "濯"
+    "濰" "瀍" "瀑" "瀚" "瀛" "瀹" "瀼" "灈" "灌" "灏" "灜" "灞" "火" "灭" "灯" "灰"
+    "灵" "灶" "灸" "灼" "灾" "灿" "炀" "炅" "炆" "炉" "炊" "炎" "炒" "炔" "炕" "炖"
+    "炘" "炙" "炜" "炟" "炤" "炫" "炬" "炭" "炮" "炯" "炳" "炷" "炸" "点" "炼" "炽"
+    "烁" "烂" "烃" "烈" "烊" "烔" "烘" "烙" "烛" "烜" "烝" "烟" "烤" "烦" "烧" "烨"
+    "烩" "烫" "烬" "热" "烯" "烷" "烹" "烺" "烽" "焉" "焊" "焌" "焓" "焕" "焖" "焘"
+    "焙" "焚" "焜" "焦" "焮" "焯" "焰" "焱" "然" "煅" "煇" "煊" "煌" "煎" "煕" "煖"
+    "煚" "煜" "煞" "煤" "煦" "照" "煨" "煬" "煮" "煲" "煽" "熀" "熄" "熇" "熊" "熏"
+    "熔" "熖" "熙" "熟" "熠" "熨" "熬" "熳" "熹" "燃" "燊" "燎" "燏" "燔" "燕" "燚"
+    "燠" "燥" "燧" "燮" "燹" "燿" "爆" "爇" "爔" "爨" "爪" "爬" "爰" "爱" "爲" "爵"
+    "父" "爷" "爸" "爹" "爻" "爽" "爿" "片" "版" "牌" "牍" "牒" "牖" "牙" "牛" "牝"
+    "牟" "牡" "牢" "牤" "牦" "牧" "物" "牮" "牯" "牲" "牵" "特" "牺" "犀" "犁" "犄"
+    "犇" "犊" "犋" "犍" "犒" "犟" "犬" "犯" "犴" "状" "犷" "犹" "狁" "狂" "狃" "狄"
+    "狈" "狎" "狐" "狒" "狗" "狙" "狝" "狞" "狠" "狡" "狩" "独" "狭" "狮" "狰" "狱"
+    "狲" "狸" "狻" "狼" "猃" "猇" "猊" "猎" "猕" "猖" "猗" "猛" "猜" "猝" "猢" "猥"
+    "猩" "猪" "猫" "猬" "献" "猱" "猴" "猷" "猾" "猿" "獐" "獗" "獠" "獬" "獭" "獾"
+    "玄" "率" "玉" "王" "玎" "玏" "玑" "玓" "玕" "玖" "玘" "玙" "玚" "玛" "玟" "玠"
+    "玢" "玥" "玦" "玩" "玫" "玭" "玮" "环" "现" "玲" "玳" "玷" "玺" "玻" "珀" "珂"
+    "珅" "珈" "珉" "珊" "珍" "珏" "珐" "珑" "珖" "珙" "珞" "珠" "珣" "珥" "珧" "珩"
+    "珪" "班" "珮" "珰" "珲" "珵" "珺" "珽" "球" "琅" "理" "琇" "琉" "琊" "琍" "琎"
+    "琏" "琐" "琓" "琖" "琚" "琛" "琢" "琤" "琥" "琦" "琨" "琪" "琬" "琭" "琮" "琯"
+    "琰" "琳" "琴" "琵" "琶" "琼" "瑀" "瑁" "瑄" "瑆" "瑊" "瑒" "瑕" "瑗" "瑙" "瑚"
+    "瑛" "瑜" "瑞" "瑟" "瑢" "瑧" "瑨" "瑩" "瑭" "瑰" "瑱" "瑶" "瑷" "瑸" "瑾" "璀"
+    "璁" "璃" "璆" "璇" "璋" "璎" "璐" "璘" "璜" "璞" "璟" "璠" "璧" "璨" "璩" "環"
+    "璿" "瓅" "瓒" "瓛" "瓜" "瓠" "瓢" "瓣" "瓦" "瓮" "瓯" "瓴" "瓶" "瓷" "瓻" "甄"
+    "甌" "甍" "甑" "甘" "甙" "甚" "甜" "生" "甡" "産" "甥" "甦" "用" "甩" "甪" "甫"
+    "甬" "甭" "甯" "田" "由" "甲" "申" "电" "男" "甸" "町" "画" "甽" "甾" "畀" "畅"
+    "畇" "畈" "畋" "界" "畎" "畏" "畑" "畓" "畔" "留" "畚" "畛" "畜" "畤" "略" "畦"
+    "番" "畯" "畲" "畴" "畸" "畹" "畿" "疃" "疆" "疋" "疏" "疑" "疗" "疙" "疚" "疝"
+    "疟" "疡" "疣" "疤" "疥" "疫" "疮" "疯" "疱" "疲" "疴" "疵" "疸" "疹" "疼" "疽"
+    "疾" "痂" "病" "症" "痈" "痉" "痊" "痍" "痒" "痔" "痕" "痘" "痛" "痞" "痢" "痣"
+    "痤" "痧" "痪" "痫" "痰" "痴" "痹" "痼" "痿" "瘀" "瘁" "瘐" "瘗" "瘘" "瘙" "瘟"
+    "瘠" "瘢" "瘤" "瘥" "瘦" "瘩" "瘪" "瘫" "瘳" "瘴" "瘵" "瘸" "瘾" "癀" "療" "癌"
+    "癔" "癖" "癜" "癞" "癣" "癫" "癸" "登" "發" "白" "百" "癿" "皁" "皂" "的" "皆"
+    "皇" "皈" "皊" "皋" "皎" "皑" "皓" "皖" "皙" "皛" "皝" "皞" "皤" "皮" "皱" "皴"
+    "皿" "盂" "盅" "盆" "盈" "益" "盍" "盎" "盏" "盐" "监" "盒" "盔" "盖" "盗" "盘"
+    "盛" "盟" "盥" "目" "盯" "盱" "盲" "直" "相" "盹" "盼" "盾" "省" "眇" "眈" "眉"
+    "看" "眙" "眛" "真" "眠" "眢" "眦" "眨" "眩" "眭" "眯" "眶" "眷" "眸" "眺" "眼"
+    "着" "睁" "睆" "睇" "睐" "睑" "睒" "睚" "睛" "睡" "睢" "督" "睦" "睨" "睪" "睫"
+    "睬" "睹" "睽" "睾" "睿" "瞀" "瞄" "瞅" "瞋" "瞌" "瞎" "瞑" "瞒" "瞟" "瞠" "瞥"
+    "瞧" "瞩" "瞪" "瞬" "瞭" "瞰" "瞳" "瞻" "瞽" "瞾" "瞿" "矗" "矛" "矜" "矢" "矣"
+    "知" "矦" "矩" "矫" "短" "矮" "石" "矶" "矽" "矾" "矿" "砀" "码" "砂" "砌" "砍"
+    "砒" "研" "砖" "砚" "砝" "砟" "砣" "砥" "砦" "砧" "砩" "砬" "砭" "砰" "砲" "破"
+    "砵" "砷" "砸" "砺" "砻" "砼" "砾" "础" "硃" "硅" "硇" "硋" "硍" "硎" "硐" "硒"
+    "硕" "硖" "硗" "硙" "硚" "硝" "硫" "硬" "确" "硷" "硼" "碁" "碇" "碉" "碌" "碍"
+    "碎" "碑" "碓" "碗" "碘" "碚" "碛" "碟" "碡" "碣" "碧" "碰" "碱" "碲" "碳" "碴"
+    "碶" "碾" "磁" "磅" "磉" "磊" "磋" "磐" "磑" "磔" "磕" "磘" "磙" "磛" "磜" "磡"
+    "磨" "磬" "磴" "磷" "磹" "磺" "磻" "磾" "礁" "礐" "礤" "礴" "示" "礻" "礼" "礽"
+    "社" "祀" "祁" "祃" "祇" "祈" "祉" "祎" "祐" "祓" "祖" "祗" "祚" "祛" "祜" "祝"
+    "神" "祟" "祠" "祥" "祧" "票" "祭" "祯" "祷" "祸" "祺" "禀" "禁" "禄" "禅" "禇"
+    "福" "禕" "禚" "禛" "禤" "禧" "禳" "禹" "禺" "离" "禽" "禾" "秀" "私" "秃" "秉"
+    "秋" "种" "秏" "科" "秒" "秘" "租" "秣" "秤" "秦" "秧" "秩" "秭" "积" "称" "秸"
+    "移" "秽" "秾" "稀" "稂" "程" "稍" "税" "稔" "稗" "稚" "稞" "稠" "稣" "稳" "稷"
+    "稹" "稻" "稼" "稽" "稿" "穂" "穆" "穑" "穗" "穰" "穴" "究" "穷" "穹" "空" "穿"
+    "突" "窃" "窄" "窈" "窊" "窍" "窑" "窒" "窕" "窖" "窗" "窘" "窜" "窝" "窟" "窠"
+    "窣" "窥" "窦" "窨" "窬" "窭" "窿" "立" "竑" "竖" "站" "竜" "竞" "竟" "章" "竣"
+    "童" "竦" "竫" "竭" "端" "競" "竹" "竺" "竻" "竽" "竿" "笃" "笄" "笆" "笈" "笋"
+    "笏" "笑" "笔" "笕" "笙" "笛" "笞" "笠" "笤" "笥" "符" "笨" "笪" "笫" "第" "笮"
+    "笳" "笺" "笼" "筀" "等" "筋" "筌" "筏" "筐" "筑" "筒" "答" "策" "筛" "筜" "筝"
+    "筠" "筮" "筱" "筲" "筵" "筷" "筹" "筼" "签" "简" "箍" "箐" "箔" "箕" "算" "管"
+    "箦" "箧" "箩" "箫" "箬" "箭" "箱" "箴" "箸" "篁" "篆" "篇" "篑" "篓" "篙" "篝"
+    "篡" "篢" "篦" "篪" "篮" "篱" "篷" "篾" "簇" "簋" "簌" "簏" "簕" "簖" "簧" "簪"
+    "簸" "簿" "籁" "籍" "米" "类" "籼" "籽" "粄" "粉" "粑" "粒" "粕" "粗" "粘" "粜"
+    "粝" "粟" "粤" "粥" "粦" "粪" "粮" "粱" "粲" "粳" "粹" "粼" "粽" "精" "粿" "糁"
+    "糅" "糊" "糌" "糍" "糕" "糖" "糗" "糙" "糜" "糟" "糠" "糯" "系" "紊" "素" "索"
+    "紧" "紫" "紬" "累" "細" "組" "絜" "絮" "統" "絷" "綦" "線" "縂" "縠" "縢" "縯"
+    "縻" "總" "繁" "繇" "纂" "纔" "纠" "纡" "红" "纣" "纤" "纥" "约" "级" "纨" "纪"
+    "纫" "纬" "纭" "纮" "纯" "纰" "纱" "纲" "纳" "纵" "纶" "纷" "纸" "纹" "纺" "纻"
+    "纽" "纾" "线" "绀" "绁" "练" "组" "绅" "细" "织" "终" "绊" "绌" "绍" "绎" "经"
+    "绐" "绑" "绒" "结" "绔" "绕" "绖" "绘" "给" "绚" "绛" "络" "绝" "绞" "统" "绠"
+    "绡" "绢" "绣" "绥" "绦" "继" "绨" "绩" "绪" "绫" "续" "绮" "绯" "绰" "绳" "维"
+    "绵" "绶" "绷" "绸" "绺" "绻" "综" "绽" "绾" "绿" "缀" "缁" "缄" "缅" "缆" "缇"
+    "缈" "缉" "缎" "缐" "缑" "缒" "缓" "缔" "缕" "编" "缗" "缘" "缙" "缚" "缜" "缝"
+    "缞" "缟" "缠" "缢" "缤" "缥" "缦" "缧" "缨" "缩" "缪" "缫" "缭" "缮" "缯" "缰"
+    "缱" "缳" "缴" "缵" "缶" "缸" "缺" "罂" "罄" "罅" "罐" "网" "罔" "罕" "罗" "罘"
+    "罚" "罡" "罢" "罥" "罩" "罪" "置" "署" "罳" "罴" "罹" "罾" "羁" "羊" "羌" "美"
+    "羑" "羔" "羖" "羚" "羞" "羟" "羡" "群" "義" "羯" "羲" "羸" "羹" "羽" "羿" "翀"
+    "翁" "翃" "翅" "翊" "翌" "翎" "翔" "翕" "翘" "翚" "翛" "翟" "翠" "翡" "翥" "翦"
+    "翩" "翮" "翯" "翰" "翱" "翳" "翻" "翼" "翾" "耀" "老" "考" "耄" "者" "耆" "耇"
+    "耋" "而" "耍" "耎" "耐" "耑" "耒" "耕" "耗" "耘" "耙" "耜" "耦" "耨" "耩" "耳"
+    "耶" "耸" "耻" "耽" "耿" "聂" "聃" "聆" "聊" "聋" "职" "聒" "联" "聖" "聘" "聚"
+    "聩" "聪" "聯" "聲" "聿" "肃" "肄" "肆" "肇" "肉" "肋" "肌" "肓" "肖" "肘" "肚"
+    "肛" "肜" "肝" "肠" "股" "肢" "肤" "肥" "肩" "肪" "肮" "肯" "肱" "育" "肴" "肸"
+    "肺" "肽" "肾" "肿" "胀" "胁" "胃" "胄" "胆" "背" "胎" "胖" "胙" "胚" "胜" "胝"
+    "胞" "胡" "胤" "胥" "胧" "胪" "胫" "胭" "胯" "胰" "胱" "胳" "胶" "胸" "胺" "能"
+    "胾" "脁" "脂" "脆" "脉" "脊" "脍" "脏" "脐" "脑" "脓" "脔" "脖" "脚" "脯" "脱"
+    "脲" "脸" "脾" "腆" "腈" "腉" "腊" "腋" "腌" "腐" "腑" "腓" "腔" "腕" "腥" "腩"
+    "腭" "腮" "腰" "腱" "腴" "腹" "腺" "腻" "腼" "腾" "腿" "膀" "膈" "膊" "膏" "膑"
+    "膘" "膛" "膜" "膝" "膦" "膨" "膳" "膺" "膻" "臀" "臂" "臃" "臆" "臊" "臛" "臣"
+    "臧" "自" "臬" "臭" "至" "致" "臻" "臼" "臾" "舀" "舁" "舂" "舄" "舅" "舆" "舌"
+    "舍" "舐" "舒" "舔" "舛" "舜" "舞" "舟" "舡" "舢" "舨" "航" "舫" "般" "舰" "舱"
+    "舲" "舵" "舶" "舷" "舸" "船" "艇" "艘" "艚" "艞" "艮" "良" "艰" "色" "艳" "艺"
+    "艻" "艽" "艾" "节" "芃" "芈" "芊" "芋" "芍" "芎" "芒" "芗" "芘" "芙" "芜" "芝"
+    "芡" "芥" "芦" "芩" "芪" "芫" "芬" "芭" "芮" "芯" "芰" "花" "芳" "芶" "芷" "芸"
+    "芹" "芽" "芾" "苁" "苄" "苇" "苈" "苋" "苌" "苍" "苎" "苏" "苑" "苒" "苓" "苔"
+    "苕" "苗" "苛" "苜" "苞" "苟" "苠" "苡" "苣" "若" "苦" "苧" "苫" "苯" "英" "苳"
+    "苴" "苷" "苹" "苻" "苾" "苿" "茀" "茁" "茂" "范" "茄" "茅" "茆" "茈" "茉" "茌"
+    "茎" "茏" "茔" "茕" "茗" "茘" "茜" "茤" "茧" "茨" "茫" "茬" "茭" "茯" "茱" "茳"
+    "茴" "茵" "茶" "茸" "茹" "茼" "荀" "荃" "荄" "荆" "荇" "草" "荏" "荐" "荒" "荔"
+    "荘" "荚" "荜" "荞" "荟" "荠" "荡" "荣" "荤" "荥" "荦" "荧" "荩" "荪" "荫" "荭"
+    "药" "荷" "荸" "荻" "荼" "荿" "莅" "莆" "莉" "莊" "莎" "莒" "莓" "莘" "莙" "莛"
+    "莜" "莞" "莠" "莨" "莩" "莪" "莫" "莱" "莲" "莳" "莴" "获" "莹" "莺" "莼" "莽"
+    "菀" "菁" "菂" "菅" "菇" "菉" "菊" "菌" "菏" "菑" "菓" "菖" "菘" "菜" "菟" "菠"
+    "菡" "菥" "菩" "華" "菰" "菱" "菲" "菴" "菻" "菽" "萁" "萃" "萄" "萊" "萌" "萍"
+    "萎" "萏" "萝" "萤" "营" "萦" "萧" "萨" "萩" "萬" "萱" "萸" "萼" "落" "葆" "葑"
+    "著" "葛" "葡" "董" "葩" "葫" "葬" "葭" "葱" "葳" "葵" "葶" "葸" "葺" "蒂" "蒉"
+    "蒋" "蒌" "蒗" "蒙" "蒜" "蒨" "蒯" "蒲" "蒴" "蒸" "蒺" "蒽" "蒿" "蓁" "蓄" "蓆"
+    "蓉" "蓍" "蓐" "蓓" "蓖" "蓝" "蓟" "蓠" "蓢" "蓥" "蓦" "蓬" "蓼" "蓿" "蔈" "蔑"
+    "蔓" "蔗" "蔚" "蔡" "蔫" "蔬" "蔷" "蔸" "蔺" "蔼" "蔽" "蕃" "蕉" "蕊" "蕗" "蕙"
+    "蕤" "蕨" "蕰" "蕲" "蕴" "蕺" "蕻" "蕾" "薄" "薇" "薏" "薛" "薜" "薤" "薨" "薪"
+    "薮" "薯" "薰" "薷" "藁" "藉" "藍" "藏" "藐" "藓" "藕" "藜" "藠" "藤" "藩" "藻"
+    "藿" "蘅" "蘋" "蘑" "蘧" "蘭" "蘸" "虎" "虏" "虐" "虑" "虒" "虓" "虔" "虚" "虞"
+    "號" "虢" "虫" "虬" "虮" "虱" "虹" "虺" "虽" "虾" "蚀" "蚁" "蚂" "蚊" "蚌" "蚓"
+    "蚕" "蚝" "蚡" "蚣" "蚤" "蚧" "蚩" "蚬" "蚯" "蚰" "蚶" "蚺" "蛀" "蛆" "蛇" "蛊"
+    "蛋" "蛎" "蛐" "蛔" "蛙" "蛛" "蛟" "蛤" "蛩" "蛭" "蛮" "蛰" "蛲" "蛳" "蛹" "蛾"
+    "蜀" "蜂" "蜃" "蜇" "蜈" "蜊" "蜍" "蜒" "蜓" "蜕" "蜗" "蜘" "蜚" "蜜" "蜞" "蜡"
+    "蜢" "蜥" "蜴" "蜷" "蜻" "蜿" "蝇" "蝉" "蝎" "蝗" "蝙" "蝠" "蝮" "蝴" "蝶" "蝼"
+    "螂" "螃" "螅" "融" "螨" "螫" "螭" "螳" "螺" "蟆" "蟋" "蟒" "蟠" "蟥" "蟭" "蟹"
+    "蟾" "蠕" "蠡" "蠢" "蠹" "血" "衅" "行" "衍" "衎" "衔" "衖" "街" "衙" "衡" "衢"
+    "衣" "补" "表" "衩" "衫" "衬" "衮" "衰" "衲" "衷" "衽" "衾" "衿" "袁" "袂" "袄"
+    "袅" "袆" "袈" "袋" "袍" "袒" "袖" "袜" "袤" "被" "袭" "袱" "袴" "裀" "裁" "裂"
+    "装" "裆" "裔" "裕" "裘" "裙" "裝" "裟" "裡" "裢" "裤" "裨" "裰" "裱" "裳" "裴"
+    "裸" "裹" "裾" "褂" "褊" "褐" "褒" "褓" "褔" "褚" "褛" "褡" "褥" "褪" "褫" "褴"
+    "褶" "襁" "襄" "襆" "襟" "襦" "西" "要" "覃" "覆" "視" "见" "观" "规" "觅" "视"
+    "觇" "览" "觉" "觊" "觌" "觎" "觐" "觑" "角" "觖" "觚" "觜" "觞" "解" "觥" "触"
+    "觳" "言" "訇" "計" "訚" "設" "訸" "訾" "詈" "詠" "詹" "誉" "誌" "誓" "諸" "謦"
+    "譞" "警" "譬" "讙" "计" "订" "讣" "认" "讥" "讦" "讧" "讨" "让" "讪" "讫" "训"
+    "议" "讯" "记" "讲" "讳" "讴" "讵" "讶" "讷" "许" "讹" "论" "讼" "讽" "设" "访"
+    "诀" "证" "诂" "诃" "评" "诅" "识" "诈" "诉" "诊" "诋" "词" "诎" "诏" "译" "诒"
+    "试" "诗" "诘" "诙" "诚" "诛" "诜" "话" "诞" "诟" "诠" "诡" "询" "诣" "诤" "该"
+    "详" "诧" "诨" "诩" "诫" "诬" "语" "诮" "误" "诰" "诱" "诲" "诳" "说" "诵" "请"
+    "诸" "诺" "读" "诽" "课" "诿" "谀" "谁" "调" "谄" "谅" "谆" "谇" "谈" "谊" "谋"
+    "谌" "谍" "谎" "谏" "谐" "谑" "谒" "谓" "谔" "谕" "谗" "谙" "谚" "谛" "谜" "谞"
+    "谟" "谡" "谢" "谣" "谤" "谥" "谦" "谧" "谨" "谩" "谪" "谬" "谭" "谮" "谯" "谰"
+    "谱" "谲" "谳" "谴" "谶" "谷" "谿" "豁" "豆" "豇" "豉" "豌" "豐" "豕" "豚" "象"
+    "豢" "豨" "豪" "豫" "豭" "豳" "豸" "豹" "豺" "貂" "貉" "貌" "貔" "貟" "資" "贇"
+    "贝" "贞" "负" "贠" "贡" "财" "责" "贤" "败" "账" "货" "质" "贩" "贪" "贫" "贬"
+    "购" "贮" "贯" "贰" "贱" "贲" "贳" "贴" "贵" "贶" "贷" "贸" "费" "贺" "贻" "贼"
+    "贽" "贾" "贿" "赀" "赁" "赂" "赃" "资" "赅" "赇" "赈" "赉" "赊" "赋" "赌" "赍"
+    "赎" "赏" "赐" "赓" "赔" "赖" "赘" "赚" "赛" "赜" "赝" "赞" "赟" "赠" "赡" "赢"
+    "赣" "赤" "赦" "赧" "赪" "赫" "赭" "走" "赳" "赴" "赵" "赶" "起" "趁" "趄" "超"
+    "越" "趋" "趟" "趣" "趱" "足" "趴" "趵" "趸" "趹" "趺" "趾" "跂" "跃" "跄" "跆"
+    "跋" "跌" "跑" "跖" "跚" "跛" "距" "跞" "跟" "跣" "跤" "跨" "跪" "跬" "路" "跳"
+    "践" "跷" "跸" "跹" "跺" "跻" "跽" "踅" "踉" "踊" "踌" "踏" "踔" "踝" "踞" "踟"
+    "踢" "踣" "踧" "踩" "踪" "踯" "踰" "踱" "踵" "踹" "踽" "蹀" "蹂" "蹄" "蹇" "蹈"
+    "蹉" "蹊" "蹋" "蹑" "蹒" "蹙" "蹦" "蹩" "蹬" "蹭" "蹰" "蹲" "蹴" "蹶" "蹻" "蹿"
+    "躁" "躅" "躇" "躏" "躞" "身" "躬" "躯" "躲" "躺" "車" "軍" "輋" "车" "轧" "轨"
+    "轩" "轫" "转" "轭" "轮" "软" "轰" "轲" "轳" "轴" "轵" "轶" "轸" "轺" "轻" "轼"
+    "载" "轾" "轿" "辂" "较" "辄" "辅" "辆" "辇" "辈" "辉" "辊" "辋" "辍" "辎" "辐"
+    "辑" "输" "辔" "辕" "辖" "辗" "辘" "辙" "辛" "辜" "辞" "辟" "辣" "辨" "辩" "辫"
+    "辰" "辱" "辶" "边" "辽" "达" "迁" "迂" "迄" "迅" "过" "迈" "迎" "运" "近" "迓"
+    "返" "迕" "还" "这" "进" "远" "违" "连" "迟" "迢" "迤" "迥" "迦" "迨" "迩" "迪"
+    "迫" "迭" "迮" "述" "迳" "迴" "迷" "迸" "迹" "迺" "追" "退" "送" "适" "逃" "逄"
+    "逅" "逆" "选" "逊" "逋" "逍" "透" "逐" "逑" "递" "途" "逖" "逗" "通" "逛" "逝"
+    "逞" "速" "造" "逡" "逢" "逦" "逮" "逯" "逵" "逶" "逸" "逻" "逼" "逾" "遁" "遂"
+    "遄" "遆" "遇" "遊" "遍" "遏" "遐" "遑" "遒" "道" "遗" "遘" "遛" "遢" "遣" "遥"
+    "遨" "遫" "遭" "遮" "遴" "遵" "遶" "遹" "遽" "避" "邀" "邂" "邃" "邈" "邋" "邑"
+    "邓" "邕" "邗" "邙" "邛" "邝" "邠" "邡" "邢" "那" "邦" "邨" "邪" "邬" "邮" "邯"
+    "邰" "邱" "邳" "邴" "邵" "邸" "邹" "邺" "邻" "邾" "郁" "郄" "郅" "郇" "郊" "郎"
+    "郏" "郐" "郑" "郓" "郗" "郚" "郜" "郝" "郞" "郡" "郢" "郤" "郦" "郧" "部" "郪"
+    "郫" "郭" "郯" "郴" "郸" "都" "郾" "郿" "鄂" "鄄" "鄌" "鄙" "鄚" "鄜" "鄞" "鄠"
+    "鄢" "鄣" "鄯" "鄱" "酂" "酃" "酄" "酆" "酇" "酉" "酊" "酋" "酌" "配" "酎" "酒"
+    "酗" "酚" "酝" "酞" "酡" "酢" "酣" "酤" "酥" "酩" "酪" "酬" "酮" "酯" "酰" "酱"
+    "酵" "酶" "酷" "酸" "酹" "酿" "醇" "醉" "醋" "醍" "醐" "醒" "醚" "醛" "醪" "醮"
+    "醴" "醵" "醺" "釂" "采" "釉" "释" "里" "重" "野" "量" "釐" "金" "釜" "鈇" "鈜"
+    "鈺" "鉏" "鉥" "鉴" "鉿" "銀" "銘" "銮" "鋆" "錡" "録" "錾" "鎏" "鎔" "鎮" "鏊"
+    "鏐" "鏖" "鐘" "鐾" "鑑" "鑙" "鑫" "钇" "针" "钉" "钊" "钎" "钏" "钐" "钒" "钓"
+    "钕" "钖" "钗" "钘" "钙" "钚" "钛" "钜" "钝" "钞" "钟" "钠" "钡" "钢" "钣" "钤"
+    "钥" "钦" "钧" "钨" "钩" "钫" "钬" "钭" "钮" "钯" "钰" "钱" "钲" "钳" "钴" "钵"
+    "钶" "钹" "钺" "钻" "钼" "钾" "钿" "铀" "铁" "铂" "铃" "铄" "铅" "铆" "铈" "铉"
+    "铋" "铌" "铎" "铐" "铕" "铖" "铙" "铚" "铛" "铜" "铝" "铞" "铟" "铠" "铢" "铣"
+    "铤" "铧" "铨" "铩" "铫" "铬" "铭" "铮" "铱" "铲" "铳" "铵" "银" "铷" "铸" "铺"
+    "铼" "链" "铿" "销" "锁" "锂" "锃" "锄" "锅" "锆" "锈" "锉" "锋" "锌" "锎" "锏"
+    "锐" "锑" "锒" "锖" "锗" "锘" "错" "锚" "锜" "锞" "锟" "锠" "锡" "锢" "锣" "锤"
+    "锥" "锦" "锨" "锫" "锬" "锭" "键" "锯" "锰" "锱" "锲" "锴" "锵" "锶" "锷" "锹"
+    "锺" "锻" "锽" "锾" "镀" "镁" "镂" "镇" "镈" "镉" "镊" "镌" "镍" "镐" "镑" "镒"
+    "镓" "镔" "镕" "镖" "镗" "镘" "镛" "镜" "镝" "镞" "镠" "镡" "镣" "镤" "镧" "镨"
+    "镪" "镫" "镬" "镭" "镯" "镰" "镱" "镳" "镵" "镶" "长" "開" "閒" "間" "閤" "闇"
+    "闟" "门" "闩" "闪" "闫" "闭" "问" "闯" "闰" "闱" "闲" "闳" "间" "闵" "闷" "闸"
+    "闹" "闺" "闻" "闼" "闽" "闾" "阀" "阁" "阂" "阃" "阅" "阆" "阈" "阉" "阊" "阍"
+    "阎" "阏" "阐" "阑" "阔" "阕" "阖" "阗" "阙" "阚" "阜" "队" "阡" "阪" "阮" "阱"
+    "防" "阳" "阴" "阵" "阶" "阻" "阾" "阿" "陀" "陂" "附" "际" "陆" "陇" "陈" "陉"
+    "陋" "陌" "降" "限" "陔" "陕" "陛" "陞" "陟" "陡" "院" "除" "陨" "险" "陪" "陬"
+    "陲" "陵" "陶" "陷" "隅" "隆" "隈" "隋" "隍" "随" "隐" "隔" "隗" "隘" "隙" "際"
+    "障" "隧" "隰" "隳" "隶" "隹" "隼" "隽" "难" "雀" "雁" "雄" "雅" "集" "雇" "雉"
+    "雌" "雍" "雎" "雏" "雒" "雕" "雨" "雩" "雪" "雯" "雲" "雳" "零" "雷" "雹" "電"
+    "雾" "需" "霁" "霂" "霄" "霆" "震" "霈" "霉" "霍" "霎" "霏" "霓" "霖" "霜" "霞"
+    "霣" "霭" "霰" "露" "霸" "霹" "霾" "青" "靓" "靖" "静" "靛" "非" "靠" "靡" "面"
+    "靥" "革" "靳" "靴" "靶" "鞅" "鞋" "鞍" "鞑" "鞘" "鞚" "鞠" "鞣" "鞫" "鞭" "韂"
+    "韓" "韡" "韦" "韧" "韩" "韪" "韫" "韬" "韭" "音" "韵" "韶" "韻" "頔" "頫" "頲"
+    "顏" "顒" "页" "顶" "顷" "项" "顺" "须" "顼" "顽" "顾" "顿" "颀" "颁" "颂" "预"
+    "颅" "领" "颇" "颈" "颉" "颊" "颋" "颌" "颍" "颐" "频" "颓" "颔" "颖" "颗" "题"
+    "颚" "颛" "颜" "额" "颠" "颡" "颢" "颤" "颦" "颧" "风" "飏" "飒" "飓" "飔" "飕"
+    "飘" "飙" "飚" "飞" "食" "飧" "飨" "餍" "餐" "餮" "饕" "饥" "饦" "饪" "饬" "饭"
+    "饮" "饯" "饰" "饱" "饲" "饴" "饵" "饶" "饷" "饺" "饼" "饽" "饿" "馀" "馁" "馅"
+    "馆" "馈" "馋" "馍" "馎" "馏" "馐" "馒" "馓" "馔" "馕" "首" "馗" "香" "馥" "馨"
+    "驩" "马" "驭" "驮" "驯" "驰" "驱" "驳" "驴" "驶" "驷" "驸" "驹" "驺" "驻" "驼"
+    "驽" "驾" "驿" "骀" "骁" "骂" "骄" "骅" "骆" "骇" "骈" "骉" "骊" "骋" "验" "骍"
+    "骎" "骏" "骐" "骑" "骕" "骖" "骗" "骘" "骙" "骚" "骛" "骜" "骝" "骞" "骠" "骡"
+    "骢" "骤" "骥" "骧" "骨" "骰" "骶" "骷" "骸" "骼" "髀" "髃" "髅" "髋" "髑" "髓"
+    "髕" "高" "髡" "髦" "髫" "髭" "髯" "髻" "鬃" "鬓" "鬟" "鬣" "鬲" "鬻" "鬼" "魁"
+    "魂" "魄" "魅" "魇" "魉" "魍" "魏" "魑" "魔" "鮀" "鱼" "鱿" "鲁" "鲅" "鲇" "鲈"
+    "鲋" "鲍" "鲐" "鲑" "鲔" "鲖" "鲛" "鲜" "鲟" "鲠" "鲡" "鲤" "鲧" "鲨" "鲰" "鲲"
+    "鲸" "鳃" "鳄" "鳊" "鳌" "鳍" "鳏" "鳖" "鳗" "鳜" "鳝" "鳞" "鴻" "鵾" "鶴" "鸟"
+    "鸠" "鸡" "鸢" "鸣" "鸥" "鸦" "鸨" "鸩" "鸪" "鸫" "鸬" "鸭" "鸮" "鸯" "鸱" "鸳"
+    "鸵" "鸶" "鸷" "鸹" "鸽" "鸾" "鸿" "鹁" "鹂" "鹃" "鹄" "鹅" "鹆" "鹉" "鹊" "鹌"
+    "鹍" "鹏" "鹑" "鹗" "鹘" "鹚" "鹜" "鹞" "鹣" "鹤" "鹦" "鹧" "鹫" "鹭" "鹰" "鹳"
+    "鹿" "麂" "麋" "麒" "麓" "麗" "麝" "麟" "麦" "麻" "麽" "麾" "黄" "黉" "黍" "黎"
+    "黏" "黑" "黔" "默" "黛" "黜" "黝" "黟" "黠" "黯" "黾" "鼋" "鼍" "鼎" "鼐" "鼓"
+    "鼠" "鼻" "鼾" "齐" "齿" "龁" "龄" "龈" "龊" "龋" "龌" "龍" "龑" "龙" "龚" "龛"
+    "龟" "" "︰" "﹐" "﹑" "﹒" "﹔" "﹖" "﹟" "＃" "（" "）" "＋" "，" "－" "．"
+    "／" "０" "１" "２" "４" "５" "６" "７" "９" "：" "Ｂ" "～" "￥";
+
+// label l reads kAlphabetData[kAlphabetOffsets[l - 1], kAlphabetOffsets[l])
+constexpr uint16_t kAlphabetOffsets[kAlphabetSize + 1] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+    90, 91, 92, 93, 94, 95, 97, 99, 101, 103,
+    105, 107, 109, 111, 113, 115, 117, 119, 121, 124,
+    127, 130, 133, 136, 139, 142, 145, 148, 151, 154,
+    157, 160, 163, 166, 169, 172, 175, 178, 181, 184,
+    187, 190, 193, 196, 199, 202, 205, 208, 211, 214,
+    217, 220, 223, 226, 229, 232, 235, 238, 241, 244,
+    247, 250, 253, 256, 259, 262, 265, 268, 271, 274,
+    277, 280, 283, 286, 289, 292, 295, 298, 301, 304,
+    307, 310, 313, 316, 319, 322, 325, 328, 331, 334,
+    337, 340, 343, 346, 349, 352, 355, 358, 361, 364,
+    367, 370, 373, 376, 379, 382, 385, 388, 391, 394,
+    397, 400, 403, 406, 409, 412, 415, 418, 421, 424,
+    427, 430, 433, 436, 439, 442, 445, 448, 451, 454,
+    457, 460, 463, 466, 469, 472, 475, 478, 481, 484,
+    487, 490, 493, 496, 499, 502, 505, 508, 511, 514,
+    517, 520, 523, 526, 529, 532, 535, 538, 541, 544,
+    547, 550, 553, 556, 559, 562, 565, 568, 571, 574,
+    577, 580, 583, 586, 589, 592, 595, 598, 601, 604,
+    607, 610, 613, 616, 619, 622, 625, 628, 631, 634,
+    637, 640, 643, 646, 649, 652, 655, 658, 661, 664,
+    667, 670, 673, 676, 679, 682, 685, 688, 691, 694,
+    697, 700, 703, 706, 709, 712, 715, 718, 721, 724,
+    727, 730, 733, 736, 739, 742, 745, 748, 751, 754,
+    757, 760, 763, 766, 769, 772, 775, 778, 781, 784,
+    787, 790, 793, 796, 799, 802, 805, 808, 811, 814,
+    817, 820, 823, 826, 829, 832, 835, 838, 841, 844,
+    847, 850, 853, 856, 859, 862, 865, 868, 871, 874,
+    877, 880, 883, 886, 889, 892, 895, 898, 901, 904,
+    907, 910, 913, 916, 919, 922, 925, 928, 931, 934,
+    937, 940, 943, 946, 949, 952, 955, 958, 961, 964,
+    967, 970, 973, 976, 979, 982, 985, 988, 991, 994,
+    997, 1000, 1003, 1006, 1009, 1012, 1015, 1018, 1021, 1024,
+    1027, 1030, 1033, 1036, 1039, 1042, 1045, 1048, 1051, 1054,
+    1057, 1060, 1063, 1066, 1069, 1072, 1075, 1078, 1081, 1084,
+    1087, 1090, 1093, 1096, 1099, 1102, 1105, 1108, 1111, 1114,
+    1117, 1120, 1123, 1126, 1129, 1132, 1135, 1138, 1141, 1144,
+    1147, 1150, 1153, 1156, 1159, 1162, 1165, 1168, 1171, 1174,
+    1177, 1180, 1183, 1186, 1189, 1192, 1195, 1198, 1201, 1204,
+    1207, 1210, 1213, 1216, 1219, 1222, 1225, 1228, 1231, 1234,
+    1237, 1240, 1243, 1246, 1249, 1252, 1255, 1258, 1261, 1264,
+    1267, 1270, 1273, 1276, 1279, 1282, 1285, 1288, 1291, 1294,
+    1297, 1300, 1303, 1306, 1309, 1312, 1315, 1318, 1321, 1324,
+    1327, 1330, 1333, 1336, 1339, 1342, 1345, 1348, 1351, 1354,
+    1357, 1360, 1363, 1366, 1369, 1372, 1375, 1378, 1381, 1384,
+    1387, 1390, 1393, 1396, 1399, 1402, 1405, 1408, 1411, 1414,
+    1417, 1420, 1423, 1426, 1429, 1432, 1435, 1438, 1441, 1444,
+    1447, 1450, 1453, 1456, 1459, 1462, 1465, 1468, 1471, 1474,
+    1477, 1480, 1483, 1486, 1489, 1492, 1495, 1498, 1501, 1504,
+    1507, 1510, 1513, 1516, 1519, 1522, 1525, 1528, 1531, 1534,
+    1537, 1540, 1543, 1546, 1549, 1552, 1555, 1558, 1561, 1564,
+    1567, 1570, 1573, 1576, 1579, 1582, 1585, 1588, 1591, 1594,
+    1597, 1600, 1603, 1606, 1609, 1612, 1615, 1618, 1621, 1624,
+    1627, 1630, 1633, 1636, 1639, 1642, 1645, 1648, 1651, 1654,
+    1657, 1660, 1663, 1666, 1669, 1672, 1675, 1678, 1681, 1684,
+    1687, 1690, 1693, 1696, 1699, 1702, 1705, 1708, 1711, 1714,
+    1717, 1720, 1723, 1726, 1729, 1732, 1735, 1738, 1741, 1744,
+    1747, 1750, 1753, 1756, 1759, 1762, 1765, 1768, 1771, 1774,
+    1777, 1780, 1783, 1786, 1789, 1792, 1795, 1798, 1801, 1804,
+    1807, 1810, 1813, 1816, 1819, 1822, 1825, 1828, 1831, 1834,
+    1837, 1840, 1843, 1846, 1849, 1852, 1855, 1858, 1861, 1864,
+    1867, 1870, 1873, 1876, 1879, 1882, 1885, 1888, 1891, 1894,
+    1897, 1900, 1903, 1906, 1909, 1912, 1915, 1918, 1921, 1924,
+    1927, 1930, 1933, 1936, 1939, 1942, 1945, 1948, 1951, 1954,
+    1957, 1960, 1963, 1966, 1969, 1972, 1975, 1978, 1981, 1984,
+    1987, 1990, 1993, 1996, 1999, 2002, 2005, 2008, 2011, 2014,
+    2017, 2020, 2023, 2026, 2029, 2032, 2035, 2038, 2041, 2044,
+    2047, 2050, 2053, 2056, 2059, 2062, 2065, 2068, 2071, 2074,
+    2077, 2080, 2083, 2086, 2089, 2092, 2095, 2098, 2101, 2104,
+    2107, 2110, 2113, 2116, 2119, 2122, 2125, 2128, 2131, 2134,
+    2137, 2140, 2143, 2146, 2149, 2152, 2155, 2158, 2161, 2164,
+    2167, 2170, 2173, 2176, 2179, 2182, 2185, 2188, 2191, 2194,
+    2197, 2200, 2203, 2206, 2209, 2212, 2215, 2218, 2221, 2224,
+    2227, 2230, 2233, 2236, 2239, 2242, 2245, 2248, 2251, 2254,
+    2257, 2260, 2263, 2266, 2269, 2272, 2275, 2278, 2281, 2284,
+    2287, 2290, 2293, 2296, 2299, 2302, 2305, 2308, 2311, 2314,
+    2317, 2320, 2323, 2326, 2329, 2332, 2335, 2338, 2341, 2344,
+    2347, 2350, 2353, 2356, 2359, 2362, 2365, 2368, 2371, 2374,
+    2377, 2380, 2383, 2386, 2389, 2392, 2395, 2398, 2401, 2404,
+    2407, 2410, 2413, 2416, 2419, 2422, 2425, 2428, 2431, 2434,
+    2437, 2440, 2443, 2446, 2449, 2452, 2455, 2458, 2461, 2464,
+    2467, 2470, 2473, 2476, 2479, 2482, 2485, 2488, 2491, 2494,
+    2497, 2500, 2503, 2506, 2509, 2512, 2515, 2518, 2521, 2524,
+    2527, 2530, 2533, 2536, 2539, 2542, 2545, 2548, 2551, 2554,
+    2557, 2560, 2563, 2566, 2569, 2572, 2575, 2578, 2581, 2584,
+    2587, 2590, 2593, 2596, 2599, 2602, 2605, 2608, 2611, 2614,
+    2617, 2620, 2623, 2626, 2629, 2632, 2635, 2638, 2641, 2644,
+    2647, 2650, 2653, 2656, 2659, 2662, 2665, 2668, 2671, 2674,
+    2677, 2680, 2683, 2686, 2689, 2692, 2695, 2698, 2701, 2704,
+    2707, 2710, 2713, 2716, 2719, 2722, 2725, 2728, 2731, 2734,
+    2737, 2740, 2743, 2746, 2749, 2752, 2755, 2758, 2761, 2764,
+    2767, 2770, 2773, 2776, 2779, 2782, 2785, 2788, 2791, 2794,
+    2797, 2800, 2803, 2806, 2809, 2812, 2815, 2818, 2821, 2824,
+    2827, 2830, 2833, 2836, 2839, 2842, 2845, 2848, 2851, 2854,
+    2857, 2860, 2863, 2866, 2869, 2872, 2875, 2878, 2881, 2884,
+    2887, 2890, 2893, 2896, 2899, 2902, 2905, 2908, 2911, 2914,
+    2917, 2920, 2923, 2926, 2929, 2932, 2935, 2938, 2941, 2944,
+    2947, 2950, 2953, 2956, 2959, 2962, 2965, 2968, 2971, 2974,
+    2977, 2980, 2983, 2986, 2989, 2992, 2995, 2998, 3001, 3004,
+    3007, 3010, 3013, 3016, 3019, 3022, 3025, 3028, 3031, 3034,
+    3037, 3040, 3043, 3046, 3049, 3052, 3055, 3058, 3061, 3064,
+    3067, 3070, 3073, 3076, 3079, 3082, 3085, 3088, 3091, 3094,
+    3097, 3100, 3103, 3106, 3109, 3112, 3115, 3118, 3121, 3124,
+    3127, 3130, 3133, 3136, 3139, 3142, 3145, 3148, 3151, 3154,
+    3157, 3160, 3163, 3166, 3169, 3172, 3175, 3178, 3181, 3184,
+    3187, 3190, 3193, 3196, 3199, 3202, 3205, 3208, 3211, 3214,
+    3217, 3220, 3223, 3226, 3229, 3232, 3235, 3238, 3241, 3244,
+    3247, 3250, 3253, 3256, 3259, 3262, 3265, 3268, 3271, 3274,
+    3277, 3280, 3283, 3286, 3289, 3292, 3295, 3298, 3301, 3304,
+    3307, 3310, 3313, 3316, 3319, 3322, 3325, 3328, 3331, 3334,
+    3337, 3340, 3343, 3346, 3349, 3352, 3355, 3358, 3361, 3364,
+    3367, 3370, 3373, 3376, 3379, 3382, 3385, 3388, 3391, 3394,
+    3397, 3400, 3403, 3406, 3409, 3412, 3415, 3418, 3421, 3424,
+    3427, 3430, 3433, 3436, 3439, 3442, 3445, 3448, 3451, 3454,
+    3457, 3460, 3463, 3466, 3469, 3472, 3475, 3478, 3481, 3484,
+    3487, 3490, 3493, 3496, 3499, 3502, 3505, 3508, 3511, 3514,
+    3517, 3520, 3523, 3526, 3529, 3532, 3535, 3538, 3541, 3544,
+    3547, 3550, 3553, 3556, 3559, 3562, 3565, 3568, 3571, 3574,
+    3577, 3580, 3583, 3586, 3589, 3592, 3595, 3598, 3601, 3604,
+    3607, 3610, 3613, 3616, 3619, 3622, 3625, 3628, 3631, 3634,
+    3637, 3640, 3643, 3646, 3649, 3652, 3655, 3658, 3661, 3664,
+    3667, 3670, 3673, 3676, 3679, 3682, 3685, 3688, 3691, 3694,
+    3697, 3700, 3703, 3706, 3709, 3712, 3715, 3718, 3721, 3724,
+    3727, 3730, 3733, 3736, 3739, 3742, 3745, 3748, 3751, 3754,
+    3757, 3760, 3763, 3766, 3769, 3772, 3775, 3778, 3781, 3784,
+    3787, 3790, 3793, 3796, 3799, 3802, 3805, 3808, 3811, 3814,
+    3817, 3820, 3823, 3826, 3829, 3832, 3835, 3838, 3841, 3844,
+    3847, 3850, 3853, 3856, 3859, 3862, 3865, 3868, 3871, 3874,
+    3877, 3880, 3883, 3886, 3889, 3892, 3895, 3898, 3901, 3904,
+    3907, 3910, 3913, 3916, 3919, 3922, 3925, 3928, 3931, 3934,
+    3937, 3940, 3943, 3946, 3949, 3952, 3955, 3958, 3961, 3964,
+    3967, 3970, 3973, 3976, 3979, 3982, 3985, 3988, 3991, 3994,
+    3997, 4000, 4003, 4006, 4009, 4012, 4015, 4018, 4021, 4024,
+    4027, 4030, 4033, 4036, 4039, 4042, 4045, 4048, 4051, 4054,
+    4057, 4060, 4063, 4066, 4069, 4072, 4075, 4078, 4081, 4084,
+    4087, 4090, 4093, 4096, 4099, 4102, 4105, 4108, 4111, 4114,
+    4117, 4120, 4123, 4126, 4129, 4132, 4135, 4138, 4141, 4144,
+    4147, 4150, 4153, 4156, 4159, 4162, 4165, 4168, 4171, 4174,
+    4177, 4180, 4183, 4186, 4189, 4192, 4195, 4198, 4201, 4204,
+    4207, 4210, 4213, 4216, 4219, 4222, 4225, 4228, 4231, 4234,
+    4237, 4240, 4243, 4246, 4249, 4252, 4255, 4258, 4261, 4264,
+    4267, 4270, 4273, 4276, 4279, 4282, 4285, 4288, 4291, 4294,
+    4297, 4300, 4303, 4306, 4309, 4312, 4315, 4318, 4321, 4324,
+    4327, 4330, 4333, 4336, 4339, 4342, 4345, 4348, 4351, 4354,
+    4357, 4360, 4363, 4366, 4369, 4372, 4375, 4378, 4381, 4384,
+    4387, 4390, 4393, 4396, 4399, 4402, 4405, 4408, 4411, 4414,
+    4417, 4420, 4423, 4426, 4429, 4432, 4435, 4438, 4441, 4444,
+    4447, 4450, 4453, 4456, 4459, 4462, 4465, 4468, 4471, 4474,
+    4477, 4480, 4483, 4486, 4489, 4492, 4495, 4498, 4501, 4504,
+    4507, 4510, 4513, 4516, 4519, 4522, 4525, 4528, 4531, 4534,
+    4537, 4540, 4543, 4546, 4549, 4552, 4555, 4558, 4561, 4564,
+    4567, 4570, 4573, 4576, 4579, 4582, 4585, 4588, 4591, 4594,
+    4597, 4600, 4603, 4606, 4609, 4612, 4615, 4618, 4621, 4624,
+    4627, 4630, 4633, 4636, 4639, 4642, 4645, 4648, 4651, 4654,
+    4657, 4660, 4663, 4666, 4669, 4672, 4675, 4678, 4681, 4684,
+    4687, 4690, 4693, 4696, 4699, 4702, 4705, 4708, 4711, 4714,
+    4717, 4720, 4723, 4726, 4729, 4732, 4735, 4738, 4741, 4744,
+    4747, 4750, 4753, 4756, 4759, 4762, 4765, 4768, 4771, 4774,
+    4777, 4780, 4783, 4786, 4789, 4792, 4795, 4798, 4801, 4804,
+    4807, 4810, 4813, 4816, 4819, 4822, 4825, 4828, 4831, 4834,
+    4837, 4840, 4843, 4846, 4849, 4852, 4855, 4858, 4861, 4864,
+    4867, 4870, 4873, 4876, 4879, 4882, 4885, 4888, 4891, 4894,
+    4897, 4900, 4903, 4906, 4909, 4912, 4915, 4918, 4921, 4924,
+    4927, 4930, 4933, 4936, 4939, 4942, 4945, 4948, 4951, 4954,
+    4957, 4960, 4963, 4966, 4969, 4972, 4975, 4978, 4981, 4984,
+    4987, 4990, 4993, 4996, 4999, 5002, 5005, 5008, 5011, 5014,
+    5017, 5020, 5023, 5026, 5029, 5032, 5035, 5038, 5041, 5044,
+    5047, 5050, 5053, 5056, 5059, 5062, 5065, 5068, 5071, 5074,
+    5077, 5080, 5083, 5086, 5089, 5092, 5095, 5098, 5101, 5104,
+    5107, 5110, 5113, 5116, 5119, 5122, 5125, 5128, 5131, 5134,
+    5137, 5140, 5143, 5146, 5149, 5152, 5155, 5158, 5161, 5164,
+    5167, 5170, 5173, 5176, 5179, 5182, 5185, 5188, 5191, 5194,
+    5197, 5200, 5203, 5206, 5209, 5212, 5215, 5218, 5221, 5224,
+    5227, 5230, 5233, 5236, 5239, 5242, 5245, 5248, 5251, 5254,
+    5257, 5260, 5263, 5266, 5269, 5272, 5275, 5278, 5281, 5284,
+    5287, 5290, 5293, 5296, 5299, 5302, 5305, 5308, 5311, 5314,
+    5317, 5320, 5323, 5326, 5329, 5332, 5335, 5338, 5341, 5344,
+    5347, 5350, 5353, 5356, 5359, 5362, 5365, 5368, 5371, 5374,
+    5377, 5380, 5383, 5386, 5389, 5392, 5395, 5398, 5401, 5404,
+    5407, 5410, 5413, 5416, 5419, 5422, 5425, 5428, 5431, 5434,
+    5437, 5440, 5443, 5446, 5449, 5452, 5455, 5458, 5461, 5464,
+    5467, 5470, 5473, 5476, 5479, 5482, 5485, 5488, 5491, 5494,
+    5497, 5500, 5503, 5506, 5509, 5512, 5515, 5518, 5521, 5524,
+    5527, 5530, 5533, 5536, 5539, 5542, 5545, 5548, 5551, 5554,
+    5557, 5560, 5563, 5566, 5569, 5572, 5575, 5578, 5581, 5584,
+    5587, 5590, 5593, 5596, 5599, 5602, 5605, 5608, 5611, 5614,
+    5617, 5620, 5623, 5626, 5629, 5632, 5635, 5638, 5641, 5644,
+    5647, 5650, 5653, 5656, 5659, 5662, 5665, 5668, 5671, 5674,
+    5677, 5680, 5683, 5686, 5689, 5692, 5695, 5698, 5701, 5704,
+    5707, 5710, 5713, 5716, 5719, 5722, 5725, 5728, 5731, 5734,
+    5737, 5740, 5743, 5746, 5749, 5752, 5755, 5758, 5761, 5764,
+    5767, 5770, 5773, 5776, 5779, 5782, 5785, 5788, 5791, 5794,
+    5797, 5800, 5803, 5806, 5809, 5812, 5815, 5818, 5821, 5824,
+    5827, 5830, 5833, 5836, 5839, 5842, 5845, 5848, 5851, 5854,
+    5857, 5860, 5863, 5866, 5869, 5872, 5875, 5878, 5881, 5884,
+    5887, 5890, 5893, 5896, 5899, 5902, 5905, 5908, 5911, 5914,
+    5917, 5920, 5923, 5926, 5929, 5932, 5935, 5938, 5941, 5944,
+    5947, 5950, 5953, 5956, 5959, 5962, 5965, 5968, 5971, 5974,
+    5977, 5980, 5983, 5986, 5989, 5992, 5995, 5998, 6001, 6004,
+    6007, 6010, 6013, 6016, 6019, 6022, 6025, 6028, 6031, 6034,
+    6037, 6040, 6043, 6046, 6049, 6052, 6055, 6058, 6061, 6064,
+    6067, 6070, 6073, 6076, 6079, 6082, 6085, 6088, 6091, 6094,
+    6097, 6100, 6103, 6106, 6109, 6112, 6115, 6118, 6121, 6124,
+    6127, 6130, 6133, 6136, 6139, 6142, 6145, 6148, 6151, 6154,
+    6157, 6160, 6163, 6166, 6169, 6172, 6175, 6178, 6181, 6184,
+    6187, 6190, 6193, 6196, 6199, 6202, 6205, 6208, 6211, 6214,
+    6217, 6220, 6223, 6226, 6229, 6232, 6235, 6238, 6241, 6244,
+    6247, 6250, 6253, 6256, 6259, 6262, 6265, 6268, 6271, 6274,
+    6277, 6280, 6283, 6286, 6289, 6292, 6295, 6298, 6301, 6304,
+    6307, 6310, 6313, 6316, 6319, 6322, 6325, 6328, 6331, 6334,
+    6337, 6340, 6343, 6346, 6349, 6352, 6355, 6358, 6361, 6364,
+    6367, 6370, 6373, 6376, 6379, 6382, 6385, 6388, 6391, 6394,
+    6397, 6400, 6403, 6406, 6409, 6412, 6415, 6418, 6421, 6424,
+    6427, 6430, 6433, 6436, 6439, 6442, 6445, 6448, 6451, 6454,
+    6457, 6460, 6463, 6466, 6469, 6472, 6475, 6478, 6481, 6484,
+    6487, 6490, 6493, 6496, 6499, 6502, 6505, 6508, 6511, 6514,
+    6517, 6520, 6523, 6526, 6529, 6532, 6535, 6538, 6541, 6544,
+    6547, 6550, 6553, 6556, 6559, 6562, 6565, 6568, 6571, 6574,
+    6577, 6580, 6583, 6586, 6589, 6592, 6595, 6598, 6601, 6604,
+    6607, 6610, 6613, 6616, 6619, 6622, 6625, 6628, 6631, 6634,
+    6637, 6640, 6643, 6646, 6649, 6652, 6655, 6658, 6661, 6664,
+    6667, 6670, 6673, 6676, 6679, 6682, 6685, 6688, 6691, 6694,
+    6697, 6700, 6703, 6706, 6709, 6712, 6715, 6718, 6721, 6724,
+    6727, 6730, 6733, 6736, 6739, 6742, 6745, 6748, 6751, 6754,
+    6757, 6760, 6763, 6766, 6769, 6772, 6775, 6778, 6781, 6784,
+    6787, 6790, 6793, 6796, 6799, 6802, 6805, 6808, 6811, 6814,
+    6817, 6820, 6823, 6826, 6829, 6832, 6835, 6838, 6841, 6844,
+    6847, 6850, 6853, 6856, 6859, 6862, 6865, 6868, 6871, 6874,
+    6877, 6880, 6883, 6886, 6889, 6892, 6895, 6898, 6901, 6904,
+    6907, 6910, 6913, 6916, 6919, 6922, 6925, 6928, 6931, 6934,
+    6937, 6940, 6943, 6946, 6949, 6952, 6955, 6958, 6961, 6964,
+    6967, 6970, 6973, 6976, 6979, 6982, 6985, 6988, 6991, 6994,
+    6997, 7000, 7003, 7006, 7009, 7012, 7015, 7018, 7021, 7024,
+    7027, 7030, 7033, 7036, 7039, 7042, 7045, 7048, 7051, 7054,
+    7057, 7060, 7063, 7066, 7069, 7072, 7075, 7078, 7081, 7084,
+    7087, 7090, 7093, 7096, 7099, 7102, 7105, 7108, 7111, 7114,
+    7117, 7120, 7123, 7126, 7129, 7132, 7135, 7138, 7141, 7144,
+    7147, 7150, 7153, 7156, 7159, 7162, 7165, 7168, 7171, 7174,
+    7177, 7180, 7183, 7186, 7189, 7192, 7195, 7198, 7201, 7204,
+    7207, 7210, 7213, 7216, 7219, 7222, 7225, 7228, 7231, 7234,
+    7237, 7240, 7243, 7246, 7249, 7252, 7255, 7258, 7261, 7264,
+    7267, 7270, 7273, 7276, 7279, 7282, 7285, 7288, 7291, 7294,
+    7297, 7300, 7303, 7306, 7309, 7312, 7315, 7318, 7321, 7324,
+    7327, 7330, 7333, 7336, 7339, 7342, 7345, 7348, 7351, 7354,
+    7357, 7360, 7363, 7366, 7369, 7372, 7375, 7378, 7381, 7384,
+    7387, 7390, 7393, 7396, 7399, 7402, 7405, 7408, 7411, 7414,
+    7417, 7420, 7423, 7426, 7429, 7432, 7435, 7438, 7441, 7444,
+    7447, 7450, 7453, 7456, 7459, 7462, 7465, 7468, 7471, 7474,
+    7477, 7480, 7483, 7486, 7489, 7492, 7495, 7498, 7501, 7504,
+    7507, 7510, 7513, 7516, 7519, 7522, 7525, 7528, 7531, 7534,
+    7537, 7540, 7543, 7546, 7549, 7552, 7555, 7558, 7561, 7564,
+    7567, 7570, 7573, 7576, 7579, 7582, 7585, 7588, 7591, 7594,
+    7597, 7600, 7603, 7606, 7609, 7612, 7615, 7618, 7621, 7624,
+    7627, 7630, 7633, 7636, 7639, 7642, 7645, 7648, 7651, 7654,
+    7657, 7660, 7663, 7666, 7669, 7672, 7675, 7678, 7681, 7684,
+    7687, 7690, 7693, 7696, 7699, 7702, 7705, 7708, 7711, 7714,
+    7717, 7720, 7723, 7726, 7729, 7732, 7735, 7738, 7741, 7744,
+    7747, 7750, 7753, 7756, 7759, 7762, 7765, 7768, 7771, 7774,
+    7777, 7780, 7783, 7786, 7789, 7792, 7795, 7798, 7801, 7804,
+    7807, 7810, 7813, 7816, 7819, 7822, 7825, 7828, 7831, 7834,
+    7837, 7840, 7843, 7846, 7849, 7852, 7855, 7858, 7861, 7864,
+    7867, 7870, 7873, 7876, 7879, 7882, 7885, 7888, 7891, 7894,
+    7897, 7900, 7903, 7906, 7909, 7912, 7915, 7918, 7921, 7924,
+    7927, 7930, 7933, 7936, 7939, 7942, 7945, 7948, 7951, 7954,
+    7957, 7960, 7963, 7966, 7969, 7972, 7975, 7978, 7981, 7984,
+    7987, 7990, 7993, 7996, 7999, 8002, 8005, 8008, 8011, 8014,
+    8017, 8020, 8023, 8026, 8029, 8032, 8035, 8038, 8041, 8044,
+    8047, 8050, 8053, 8056, 8059, 8062, 8065, 8068, 8071, 8074,
+    8077, 8080, 8083, 8086, 8089, 8092, 8095, 8098, 8101, 8104,
+    8107, 8110, 8113, 8116, 8119, 8122, 8125, 8128, 8131, 8134,
+    8137, 8140, 8143, 8146, 8149, 8152, 8155, 8158, 8161, 8164,
+    8167, 8170, 8173, 8176, 8179, 8182, 8185, 8188, 8191, 8194,
+    8197, 8200, 8203, 8206, 8209, 8212, 8215, 8218, 8221, 8224,
+    8227, 8230, 8233, 8236, 8239, 8242, 8245, 8248, 8251, 8254,
+    8257, 8260, 8263, 8266, 8269, 8272, 8275, 8278, 8281, 8284,
+    8287, 8290, 8293, 8296, 8299, 8302, 8305, 8308, 8311, 8314,
+    8317, 8320, 8323, 8326, 8329, 8332, 8335, 8338, 8341, 8344,
+    8347, 8350, 8353, 8356, 8359, 8362, 8365, 8368, 8371, 8374,
+    8377, 8380, 8383, 8386, 8389, 8392, 8395, 8398, 8401, 8404,
+    8407, 8410, 8413, 8416, 8419, 8422, 8425, 8428, 8431, 8434,
+    8437, 8440, 8443, 8446, 8449, 8452, 8455, 8458, 8461, 8464,
+    8467, 8470, 8473, 8476, 8479, 8482, 8485, 8488, 8491, 8494,
+    8497, 8500, 8503, 8506, 8509, 8512, 8515, 8518, 8521, 8524,
+    8527, 8530, 8533, 8536, 8539, 8542, 8545, 8548, 8551, 8554,
+    8557, 8560, 8563, 8566, 8569, 8572, 8575, 8578, 8581, 8584,
+    8587, 8590, 8593, 8596, 8599, 8602, 8605, 8608, 8611, 8614,
+    8617, 8620, 8623, 8626, 8629, 8632, 8635, 8638, 8641, 8644,
+    8647, 8650, 8653, 8656, 8659, 8662, 8665, 8668, 8671, 8674,
+    8677, 8680, 8683, 8686, 8689, 8692, 8695, 8698, 8701, 8704,
+    8707, 8710, 8713, 8716, 8719, 8722, 8725, 8728, 8731, 8734,
+    8737, 8740, 8743, 8746, 8749, 8752, 8755, 8758, 8761, 8764,
+    8767, 8770, 8773, 8776, 8779, 8782, 8785, 8788, 8791, 8794,
+    8797, 8800, 8803, 8806, 8809, 8812, 8815, 8818, 8821, 8824,
+    8827, 8830, 8833, 8836, 8839, 8842, 8845, 8848, 8851, 8854,
+    8857, 8860, 8863, 8866, 8869, 8872, 8875, 8878, 8881, 8884,
+    8887, 8890, 8893, 8896, 8899, 8902, 8905, 8908, 8911, 8914,
+    8917, 8920, 8923, 8926, 8929, 8932, 8935, 8938, 8941, 8944,
+    8947, 8950, 8953, 8956, 8959, 8962, 8965, 8968, 8971, 8974,
+    8977, 8980, 8983, 8986, 8989, 8992, 8995, 8998, 9001, 9004,
+    9007, 9010, 9013, 9016, 9019, 9022, 9025, 9028, 9031, 9034,
+    9037, 9040, 9043, 9046, 9049, 9052, 9055, 9058, 9061, 9064,
+    9067, 9070, 9073, 9076, 9079, 9082, 9085, 9088, 9091, 9094,
+    9097, 9100, 9103, 9106, 9109, 9112, 9115, 9118, 9121, 9124,
+    9127, 9130, 9133, 9136, 9139, 9142, 9145, 9148, 9151, 9154,
+    9157, 9160, 9163, 9166, 9169, 9172, 9175, 9178, 9181, 9184,
+    9187, 9190, 9193, 9196, 9199, 9202, 9205, 9208, 9211, 9214,
+    9217, 9220, 9223, 9226, 9229, 9232, 9235, 9238, 9241, 9244,
+    9247, 9250, 9253, 9256, 9259, 9262, 9265, 9268, 9271, 9274,
+    9277, 9280, 9283, 9286, 9289, 9292, 9295, 9298, 9301, 9304,
+    9307, 9310, 9313, 9316, 9319, 9322, 9325, 9328, 9331, 9334,
+    9337, 9340, 9343, 9346, 9349, 9352, 9355, 9358, 9361, 9364,
+    9367, 9370, 9373, 9376, 9379, 9382, 9385, 9388, 9391, 9394,
+    9397, 9400, 9403, 9406, 9409, 9412, 9415, 9418, 9421, 9424,
+    9427, 9430, 9433, 9436, 9439, 9442, 9445, 9448, 9451, 9454,
+    9457, 9460, 9463, 9466, 9469, 9472, 9475, 9478, 9481, 9484,
+    9487, 9490, 9493, 9496, 9499, 9502, 9505, 9508, 9511, 9514,
+    9517, 9520, 9523, 9526, 9529, 9532, 9535, 9538, 9541, 9544,
+    9547, 9550, 9553, 9556, 9559, 9562, 9565, 9568, 9571, 9574,
+    9577, 9580, 9583, 9586, 9589, 9592, 9595, 9598, 9601, 9604,
+    9607, 9610, 9613, 9616, 9619, 9622, 9625, 9628, 9631, 9634,
+    9637, 9640, 9643, 9646, 9649, 9652, 9655, 9658, 9661, 9664,
+    9667, 9670, 9673, 9676, 9679, 9682, 9685, 9688, 9691, 9694,
+    9697, 9700, 9703, 9706, 9709, 9712, 9715, 9718, 9721, 9724,
+    9727, 9730, 9733, 9736, 9739, 9742, 9745, 9748, 9751, 9754,
+    9757, 9760, 9763, 9766, 9769, 9772, 9775, 9778, 9781, 9784,
+    9787, 9790, 9793, 9796, 9799, 9802, 9805, 9808, 9811, 9814,
+    9817, 9820, 9823, 9826, 9829, 9832, 9835, 9838, 9841, 9844,
+    9847, 9850, 9853, 9856, 9859, 9862, 9865, 9868, 9871, 9874,
+    9877, 9880, 9883, 9886, 9889, 9892, 9895, 9898, 9901, 9904,
+    9907, 9910, 9913, 9916, 9919, 9922, 9925, 9928, 9931, 9934,
+    9937, 9940, 9943, 9946, 9949, 9952, 9955, 9958, 9961, 9964,
+    9967, 9970, 9973, 9976, 9979, 9982, 9985, 9988, 9991, 9994,
+    9997, 10000, 10003, 10006, 10009, 10012, 10015, 10018, 10021, 10024,
+    10027, 10030, 10033, 10036, 10039, 10042, 10045, 10048, 10051, 10054,
+    10057, 10060, 10063, 10066, 10069, 10072, 10075, 10078, 10081, 10084,
+    10087, 10090, 10093, 10096, 10099, 10102, 10105, 10108, 10111, 10114,
+    10117, 10120, 10123, 10126, 10129, 10132, 10135, 10138, 10141, 10144,
+    10147, 10150, 10153, 10156, 10159, 10162, 10165, 10168, 10171, 10174,
+    10177, 10180, 10183, 10186, 10189, 10192, 10195, 10198, 10201, 10204,
+    10207, 10210, 10213, 10216, 10219, 10222, 10225, 10228, 10231, 10234,
+    10237, 10240, 10243, 10246, 10249, 10252, 10255, 10258, 10261, 10264,
+    10267, 10270, 10273, 10276, 10279, 10282, 10285, 10288, 10291, 10294,
+    10297, 10300, 10303, 10306, 10309, 10312, 10315, 10318, 10321, 10324,
+    10327, 10330, 10333, 10336, 10339, 10342, 10345, 10348, 10351, 10354,
+    10357, 10360, 10363, 10366, 10369, 10372, 10375, 10378, 10381, 10384,
+    10387, 10390, 10393, 10396, 10399, 10402, 10405, 10408, 10411, 10414,
+    10417, 10420, 10423, 10426, 10429, 10432, 10435, 10438, 10441, 10444,
+    10447, 10450, 10453, 10456, 10459, 10462, 10465, 10468, 10471, 10474,
+    10477, 10480, 10483, 10486, 10489, 10492, 10495, 10498, 10501, 10504,
+    10507, 10510, 10513, 10516, 10519, 10522, 10525, 10528, 10531, 10534,
+    10537, 10540, 10543, 10546, 10549, 10552, 10555, 10558, 10561, 10564,
+    10567, 10570, 10573, 10576, 10579, 10582, 10585, 10588, 10591, 10594,
+    10597, 10600, 10603, 10606, 10609, 10612, 10615, 10618, 10621, 10624,
+    10627, 10630, 10633, 10636, 10639, 10642, 10645, 10648, 10651, 10654,
+    10657, 10660, 10663, 10666, 10669, 10672, 10675, 10678, 10681, 10684,
+    10687, 10690, 10693, 10696, 10699, 10702, 10705, 10708, 10711, 10714,
+    10717, 10720, 10723, 10726, 10729, 10732, 10735, 10738, 10741, 10744,
+    10747, 10750, 10753, 10756, 10759, 10762, 10765, 10768, 10771, 10774,
+    10777, 10780, 10783, 10786, 10789, 10792, 10795, 10798, 10801, 10804,
+    10807, 10810, 10813, 10816, 10819, 10822, 10825, 10828, 10831, 10834,
+    10837, 10840, 10843, 10846, 10849, 10852, 10855, 10858, 10861, 10864,
+    10867, 10870, 10873, 10876, 10879, 10882, 10885, 10888, 10891, 10894,
+    10897, 10900, 10903, 10906, 10909, 10912, 10915, 10918, 10921, 10924,
+    10927, 10930, 10933, 10936, 10939, 10942, 10945, 10948, 10951, 10954,
+    10957, 10960, 10963, 10966, 10969, 10972, 10975, 10978, 10981, 10984,
+    10987, 10990, 10993, 10996, 10999, 11002, 11005, 11008, 11011, 11014,
+    11017, 11020, 11023, 11026, 11029, 11032, 11035, 11038, 11041, 11044,
+    11047, 11050, 11053, 11056, 11059, 11062, 11065, 11068, 11071, 11074,
+    11077, 11080, 11083, 11086, 11089, 11092, 11095, 11098, 11101, 11104,
+    11107, 11110, 11113, 11116, 11119, 11122, 11125, 11128, 11131, 11134,
+    11137, 11140, 11143, 11146, 11149, 11152, 11155, 11158, 11161, 11164,
+    11167, 11170, 11173, 11176, 11179, 11182, 11185, 11188, 11191, 11194,
+    11197, 11200, 11203, 11206, 11209, 11212, 11215, 11218, 11221, 11224,
+    11227, 11230, 11233, 11236, 11239, 11242, 11245, 11248, 11251, 11254,
+    11257, 11260, 11263, 11266, 11269, 11272, 11275, 11278, 11281, 11284,
+    11287, 11290, 11293, 11296, 11299, 11302, 11305, 11308, 11311, 11314,
+    11317, 11320, 11323, 11326, 11329, 11332, 11335, 11338, 11341, 11344,
+    11347, 11350, 11353, 11356, 11359, 11362, 11365, 11368, 11371, 11374,
+    11377, 11380, 11383, 11386, 11389, 11392, 11395, 11398, 11401, 11404,
+    11407, 11410, 11413, 11416, 11419, 11422, 11425, 11428, 11431, 11434,
+    11437, 11440, 11443, 11446, 11449, 11452, 11455, 11458, 11461, 11464,
+    11467, 11470, 11473, 11476, 11479, 11482, 11485, 11488, 11491, 11494,
+    11497, 11500, 11503, 11506, 11509, 11512, 11515, 11518, 11521, 11524,
+    11527, 11530, 11533, 11536, 11539, 11542, 11545, 11548, 11551, 11554,
+    11557, 11560, 11563, 11566, 11569, 11572, 11575, 11578, 11581, 11584,
+    11587, 11590, 11593, 11596, 11599, 11602, 11605, 11608, 11611, 11614,
+    11617, 11620, 11623, 11626, 11629, 11632, 11635, 11638, 11641, 11644,
+    11647, 11650, 11653, 11656, 11659, 11662, 11665, 11668, 11671, 11674,
+    11677, 11680, 11683, 11686, 11689, 11692, 11695, 11698, 11701, 11704,
+    11707, 11710, 11713, 11716, 11719, 11722, 11725, 11728, 11731, 11734,
+    11737, 11740, 11743, 11746, 11749, 11752, 11755, 11758, 11761, 11764,
+    11767, 11770, 11773, 11776, 11779, 11782, 11785, 11788, 11791, 11794,
+    11797, 11800, 11803, 11806, 11809, 11812, 11815, 11818, 11821, 11824,
+    11827, 11830, 11833, 11836, 11839, 11842, 11845, 11848, 11851, 11854,
+    11857, 11860, 11863, 11866, 11869, 11872, 11875, 11878, 11881, 11884,
+    11887, 11890, 11893, 11896, 11899, 11902, 11905, 11908, 11911, 11914,
+    11917, 11920, 11923, 11926, 11929, 11932, 11935, 11938, 11941, 11944,
+    11947, 11950, 11953, 11956, 11959, 11962, 11965, 11968, 11971, 11974,
+    11977, 11980, 11983, 11986, 11989, 11992, 11995, 11998, 12001, 12004,
+    12007, 12010, 12013, 12016, 12019, 12022, 12025, 12028, 12031, 12034,
+    12037, 12040, 12043, 12046, 12049, 12052, 12055, 12058, 12061, 12064,
+    12067, 12070, 12073, 12076, 12079, 12082, 12085, 12088, 12091, 12094,
+    12097, 12100, 12103, 12106, 12109, 12112, 12115, 12118, 12121, 12124,
+    12127, 12130, 12133, 12136, 12139, 12142, 12145, 12148, 12151, 12154,
+    12157, 12160, 12163, 12166, 12169, 12172, 12175, 12178, 12181, 12184,
+    12187, 12190, 12193, 12196, 12199, 12202, 12205, 12208, 12211, 12214,
+    12217, 12220, 12223, 12226, 12229, 12232, 12235, 12238, 12241, 12244,
+    12247, 12250, 12253, 12256, 12259, 12262, 12265, 12268, 12271, 12274,
+    12277, 12280, 12283, 12286, 12289, 12292, 12295, 12298, 12301, 12304,
+    12307, 12310, 12313, 12316, 12319, 12322, 12325, 12328, 12331, 12334,
+    12337, 12340, 12343, 12346, 12349, 12352, 12355, 12358, 12361, 12364,
+    12367, 12370, 12373, 12376, 12379, 12382, 12385, 12388, 12391, 12394,
+    12397, 12400, 12403, 12406, 12409, 12412, 12415, 12418, 12421, 12424,
+    12427, 12430, 12433, 12436, 12439, 12442, 12445, 12448, 12451, 12454,
+    12457, 12460, 12463, 12466, 12469, 12472, 12475, 12478, 12481, 12484,
+    12487, 12490, 12493, 12496, 12499, 12502, 12505, 12508, 12511, 12514,
+    12517, 12520, 12523, 12526, 12529, 12532, 12535, 12538, 12541, 12544,
+    12547, 12550, 12553, 12556, 12559, 12562, 12565, 12568, 12571, 12574,
+    12577, 12580, 12583, 12586, 12589, 12592, 12595, 12598, 12601, 12604,
+    12607, 12610, 12613, 12616, 12619, 12622, 12625, 12628, 12631, 12634,
+    12637, 12640, 12643, 12646, 12649, 12652, 12655, 12658, 12661, 12664,
+    12667, 12670, 12673, 12676, 12679, 12682, 12685, 12688, 12691, 12694,
+    12697, 12700, 12703, 12706, 12709, 12712, 12715, 12718, 12721, 12724,
+    12727, 12730, 12733, 12736, 12739, 12742, 12745, 12748, 12751, 12754,
+    12757, 12760, 12763, 12766, 12769, 12772, 12775, 12778, 12781, 12784,
+    12787, 12790, 12793, 12796, 12799, 12802, 12805, 12808, 12811, 12814,
+    12817, 12820, 12823, 12826, 12829, 12832, 12835, 12838, 12841, 12844,
+    12847, 12850, 12853, 12856, 12859, 12862, 12865, 12868, 12871, 12874,
+    12877, 12880, 12883, 12886, 12889, 12892, 12895, 12898, 12901, 12904,
+    12907, 12910, 12913, 12916, 12919, 12922, 12925, 12928, 12931, 12934,
+    12937, 12940, 12943, 12946, 12949, 12952, 12955, 12958, 12961, 12964,
+    12967, 12970, 12973, 12976, 12979, 12982, 12985, 12988, 12991, 12994,
+    12997, 13000, 13003, 13006, 13009, 13012, 13015, 13018, 13021, 13024,
+    13027, 13030, 13033, 13036, 13039, 13042, 13045, 13048, 13051, 13054,
+    13057, 13060, 13063, 13066, 13069, 13072, 13075, 13078, 13081, 13084,
+    13087, 13090, 13093, 13096, 13099, 13102, 13105, 13108, 13111, 13114,
+    13117, 13120, 13123, 13126, 13129, 13132, 13135, 13138, 13141, 13144,
+    13147, 13150, 13153, 13156, 13159, 13162, 13165, 13168, 13171, 13174,
+    13177, 13180, 13183, 13186, 13189, 13192, 13195, 13198, 13201, 13204,
+    13207, 13210, 13213, 13216, 13219, 13222, 13225, 13228, 13231, 13234,
+    13237, 13240, 13243, 13246, 13249, 13252, 13255, 13258, 13261, 13264,
+    13267, 13270, 13273, 13276, 13279, 13282, 13285, 13288, 13291, 13294,
+    13297, 13300, 13303, 13306, 13309, 13312, 13315, 13318, 13321, 13324,
+    13327, 13330, 13333, 13336, 13339, 13342, 13345, 13348, 13351, 13354,
+    13357, 13360, 13363, 13366, 13369, 13372, 13375, 13378, 13381, 13384,
+    13387, 13390, 13393, 13396, 13399, 13402, 13405, 13408, 13411, 13414,
+    13417, 13420, 13423, 13426, 13429, 13432, 13435, 13438, 13441, 13444,
+    13447, 13450, 13453, 13456, 13459, 13462, 13465, 13468, 13471, 13474,
+    13477, 13480, 13483, 13486, 13489, 13492, 13495, 13498, 13501, 13504,
+    13507, 13510, 13513, 13516, 13519, 13522, 13525, 13528, 13531, 13534,
+    13537, 13540, 13543, 13546, 13549, 13552, 13555, 13558, 13561, 13564,
+    13567, 13570, 13573, 13576, 13579, 13582, 13585, 13588, 13591, 13594,
+    13597, 13600, 13603, 13606, 13609, 13612, 13615, 13618, 13621, 13624,
+    13627, 13630, 13633, 13636, 13639, 13642, 13645, 13648, 13651, 13654,
+    13657, 13660, 13663, 13666, 13669, 13672, 13675, 13678, 13681, 13684,
+    13687, 13690, 13693, 13696, 13699, 13702, 13705, 13708, 13711, 13714,
+    13717, 13720, 13723, 13726, 13729, 13732, 13735, 13738, 13741, 13744,
+    13747, 13750, 13753, 13756, 13759, 13762, 13765, 13768, 13771, 13774,
+    13777, 13780, 13783, 13786, 13789, 13792, 13795, 13798, 13801, 13804,
+    13807, 13810, 13813, 13816, 13819, 13822, 13825, 13828, 13831, 13834,
+    13837, 13840, 13843, 13846, 13849, 13852, 13855, 13858, 13861, 13864,
+    13867, 13870, 13873, 13876, 13879, 13882, 13885, 13888, 13891, 13894,
+    13897, 13900, 13903, 13906, 13909, 13912, 13915, 13918, 13921, 13924,
+    13927, 13930, 13933, 13936, 13939, 13942, 13945, 13948, 13951, 13954,
+    13957, 13960, 13963, 13966, 13969, 13972, 13975, 13978, 13981, 13984,
+    13987, 13990, 13993, 13996, 13999, 14002, 14005, 14008, 14011, 14014,
+    14017, 14020, 14023, 14026, 14029, 14032, 14035, 14038, 14041, 14044,
+    14047, 14050, 14053, 14056, 14059, 14062, 14065, 14068, 14071, 14074,
+    14077, 14080, 14083, 14086, 14089, 14092, 14095, 14098, 14101, 14104,
+    14107, 14110, 14113, 14116, 14119, 14122, 14125, 14128, 14131, 14134,
+    14137, 14140, 14143, 14146, 14149, 14152, 14155, 14158, 14161, 14164,
+    14167, 14170, 14173, 14176, 14179, 14182, 14185, 14188, 14191, 14194,
+    14197, 14200, 14203, 14206, 14209, 14212, 14215, 14218, 14221, 14224,
+    14227, 14230, 14233, 14236, 14239, 14242, 14245, 14248, 14251, 14254,
+    14257, 14260, 14263, 14266, 14269, 14272, 14275, 14278, 14281, 14284,
+    14287, 14290, 14293, 14296, 14299, 14302, 14305, 14308, 14311, 14314,
+    14317, 14320, 14323, 14326, 14329, 14332, 14335, 14338, 14341, 14344,
+    14347, 14350, 14353, 14356, 14359, 14362, 14365, 14368, 14371, 14374,
+    14377, 14380, 14383, 14386, 14389, 14392, 14395, 14398, 14401, 14404,
+    14407, 14410, 14413, 14416, 14419, 14422, 14425, 14428, 14431, 14434,
+    14437, 14440, 14443, 14446, 14449, 14452, 14455, 14458, 14461, 14464,
+    14467, 14470, 14473, 14476, 14479, 14482, 14485, 14488, 14491, 14494,
+    14497, 14500, 14503, 14506, 14509, 14512, 14515, 14518, 14521, 14524,
+    14527, 14530, 14533, 14536, 14539, 14542, 14545, 14548, 14551, 14554,
+    14557, 14560, 14563, 14566, 14569, 14572, 14575, 14578, 14581, 14584,
+    14587, 14590, 14593, 14596, 14599, 14602, 14605, 14608, 14611, 14614,
+    14617, 14620, 14623, 14626, 14629, 14632, 14635, 14638, 14641, 14644,
+    14647, 14650, 14653, 14656, 14659, 14662, 14665, 14668, 14671, 14674,
+    14677, 14680, 14683, 14686, 14689, 14692, 14695, 14698, 14701, 14704,
+    14707, 14710, 14713, 14716, 14719, 14722, 14725, 14728, 14731, 14734,
+    14737, 14740, 14743, 14746, 14749, 14752, 14755, 14758, 14761, 14764,
+    14767, 14770, 14773, 14776, 14779, 14782, 14785, 14788, 14791, 14794,
+    14797, 14800, 14803, 14806, 14809, 14812, 14815, 14818, 14821, 14824,
+    14827, 14830, 14833, 14836, 14839, 14842, 14845, 14848, 14851, 14854,
+    14857, 14860, 14863, 14866, 14869, 14872, 14875, 14878, 14881, 14884,
+    14887, 14890, 14893, 14896, 14899, 14902, 14905, 14908, 14911, 14914,
+    14917, 14920, 14923, 14926, 14929, 14932, 14935, 14938, 14941, 14944,
+    14947, 14950, 14953, 14956, 14959, 14962, 14965, 14968, 14971, 14974,
+    14977, 14980, 14983, 14986, 14989, 14992, 14995, 14998, 15001, 15004,
+    15007, 15010, 15013, 15016, 15019, 15022, 15025, 15028, 15031, 15034,
+    15037, 15040, 15043, 15046, 15049, 15052, 15055, 15058, 15061, 15064,
+    15067, 15070, 15073, 15076, 15079, 15082, 15085, 15088, 15091, 15094,
+    15097, 15100, 15103, 15106, 15109, 15112, 15115, 15118, 15121, 15124,
+    15127, 15130, 15133, 15136, 15139, 15142, 15145, 15148, 15151, 15154,
+    15157, 15160, 15163, 15166, 15169, 15172, 15175, 15178, 15181, 15184,
+    15187, 15190, 15193, 15196, 15199, 15202, 15205, 15208, 15211, 15214,
+    15217, 15220, 15223, 15226, 15229, 15232, 15235, 15238, 15241, 15244,
+    15247, 15250, 15253, 15256, 15259, 15262, 15265, 15268, 15271, 15274,
+    15277, 15280, 15283, 15286, 15289, 15292, 15295, 15298, 15301, 15304,
+    15307, 15310, 15313, 15316, 15319, 15322, 15325, 15328, 15331, 15334,
+    15337, 15340, 15343, 15346, 15349, 15352, 15355, 15358, 15361, 15364,
+    15367, 15370, 15373, 15376, 15379, 15382, 15385, 15388, 15391, 15394,
+    15397, 15400, 15403, 15406, 15409, 15412, 15415, 15418, 15421, 15424,
+    15427, 15430, 15433, 15436, 15439, 15442, 15445, 15448, 15451, 15454,
+    15457, 15460, 15463, 15466, 15469, 15472, 15475, 15478, 15481, 15484,
+    15487, 15490, 15493, 15496, 15499, 15502, 15505, 15508, 15511, 15514,
+    15517, 15520, 15523, 15526, 15529, 15532, 15535, 15538, 15541, 15544,
+    15547, 15550, 15553, 15556, 15559, 15562, 15565, 15568, 15571, 15574,
+    15577, 15580, 15583, 15586, 15589, 15592, 15595, 15598, 15601, 15604,
+    15607, 15610, 15613, 15616, 15619, 15622, 15625, 15628, 15631, 15634,
+    15637, 15640, 15643, 15646, 15649, 15652, 15655, 15658, 15661, 15664,
+    15667, 15670, 15673, 15676, 15679, 15682, 15685, 15688, 15691, 15694,
+    15697, 15700, 15703, 15706, 15709, 15712, 15715, 15718, 15721, 15724,
+    15727, 15730, 15733, 15736, 15739, 15742, 15745, 15748, 15751, 15754,
+    15757, 15760, 15763, 15766, 15769, 15772, 15775, 15778, 15781, 15784,
+    15787, 15790, 15793, 15796, 15799, 15802, 15805, 15808, 15811, 15814,
+    15817, 15820, 15823, 15826, 15829, 15832, 15835, 15838, 15841, 15844,
+    15847, 15850, 15853, 15856, 15859, 15862, 15865, 15868, 15871, 15874,
+    15877, 15880, 15883, 15886, 15889, 15892, 15895, 15898, 15901, 15904,
+    15907, 15910, 15913, 15916, 15919, 15922, 15925, 15928, 15931, 15934,
+    15937, 15940, 15943, 15946, 15949, 15952, 15955, 15958, 15961, 15964,
+    15967, 15970, 15973, 15976, 15979, 15982, 15985, 15988, 15991, 15994,
+    15997, 16000, 16003, 16006, 16009, 16012, 16015, 16018, 16021, 16024,
+    16027, 16030, 16033, 16036, 16039, 16042, 16045, 16048, 16051, 16054,
+    16057, 16060, 16063, 16066, 16069, 16072, 16075, 16078, 16081, 16084,
+    16087, 16090, 16093, 16096, 16099, 16102, 16105, 16108, 16111, 16114,
+    16117, 16120, 16123, 16126, 16129, 16132, 16135, 16138, 16141, 16144,
+    16147, 16150, 16153, 16156, 16159, 16162, 16165, 16168, 16171, 16174,
+    16177, 16180, 16183, 16186, 16189, 16192, 16195, 16198, 16201, 16204,
+    16207, 16210, 16213, 16216, 16219, 16222, 16225, 16228, 16231, 16234,
+    16237, 16240, 16243, 16246, 16249, 16252, 16255, 16258, 16261, 16264,
+    16267, 16270, 16273, 16276, 16279, 16282, 16285, 16288, 16291, 16294,
+    16297, 16300, 16303, 16306, 16309, 16312, 16315, 16318, 16321, 16324,
+    16327, 16330, 16333, 16336, 16339, 16342, 16345, 16348, 16351, 16354,
+    16357, 16360, 16363, 16366, 16369, 16372, 16375, 16378, 16381, 16384,
+    16387, 16390, 16393, 16396, 16399, 16402, 16405, 16408, 16411, 16414,
+    16417, 16420, 16423, 16426, 16429, 16432, 16435, 16438, 16441, 16444,
+    16447, 16450, 16453, 16456, 16459, 16462, 16465, 16468, 16471, 16474,
+    16477, 16480, 16483, 16486, 16489, 16492, 16495, 16498, 16501, 16504,
+    16507, 16510, 16513, 16516, 16519, 16522, 16525, 16528, 16531, 16534,
+    16537, 16540, 16543, 16546, 16549, 16552, 16555, 16558, 16561, 16564,
+    16567, 16570, 16573, 16576, 16579, 16582, 16585, 16588, 16591, 16594,
+    16597, 16600, 16603, 16606, 16609, 16612, 16615, 16618, 16621, 16624,
+    16627, 16630, 16633, 16636, 16639, 16642, 16645, 16648, 16651, 16654,
+    16657, 16660, 16663, 16666, 16669, 16672, 16675, 16678, 16681, 16684,
+    16687, 16690, 16693, 16696, 16699, 16702, 16705, 16708, 16711, 16714,
+    16717, 16720, 16723, 16726, 16729, 16732, 16735, 16738, 16741, 16744,
+    16747, 16750, 16753, 16756, 16759, 16762, 16765, 16768, 16771, 16774,
+    16777, 16780, 16783, 16786, 16789, 16792, 16795, 16798, 16801, 16804,
+    16807, 16810, 16813, 16816, 16819, 16822, 16825, 16828, 16831, 16834,
+    16837, 16840, 16843, 16846, 16849, 16852, 16855, 16858, 16861, 16864,
+    16867, 16870, 16873, 16876, 16879, 16882, 16885, 16888, 16891, 16894,
+    16897, 16900, 16903, 16906, 16909, 16912, 16915, 16918, 16921, 16924,
+    16927, 16930, 16933, 16936, 16939, 16942, 16945, 16948, 16951, 16954,
+    16957, 16960, 16963, 16966, 16969, 16972, 16975, 16978, 16981, 16984,
+    16987, 16990, 16993, 16996, 16999, 17002, 17005, 17008, 17011, 17014,
+    17017, 17020, 17023, 17026, 17029, 17032, 17035, 17038, 17041, 17044,
+    17047, 17050, 17053, 17056, 17059, 17062, 17065, 17068, 17071, 17074,
+    17077, 17080, 17083, 17086, 17089, 17092, 17095, 17098, 17101, 17104,
+    17107, 17110, 17113, 17116, 17119, 17122, 17125, 17128, 17131, 17134,
+    17137, 17140, 17143, 17146, 17149, 17152, 17155, 17158, 17161, 17164,
+    17167, 17170, 17173, 17176, 17179, 17182, 17185, 17188, 17191, 17194,
+    17197, 17200, 17203, 17206, 17209, 17212, 17215, 17218, 17221, 17224,
+    17227, 17230, 17233, 17236, 17239, 17242, 17245, 17248, 17251, 17254,
+    17257, 17260, 17263, 17266, 17269, 17272, 17275, 17278, 17281, 17284,
+    17287, 17290, 17293, 17296, 17299, 17302, 17305, 17308, 17311, 17314,
+    17317, 17320, 17323, 17326, 17329, 17332, 17335, 17338, 17341, 17344,
+    17347, 17350, 17353, 17356, 17359, 17362, 17365, 17368, 17371, 17374,
+    17377, 17380, 17383, 17386, 17389, 17392, 17395, 17398, 17401, 17404,
+    17407, 17410, 17413, 17416, 17419, 17422, 17425, 17428, 17431, 17434,
+    17437, 17440, 17443, 17446, 17449, 17452, 17455, 17458, 17461, 17464,
+    17467, 17470, 17473, 17476, 17479, 17482, 17485, 17488, 17491, 17494,
+    17497, 17500, 17503, 17506, 17509, 17512, 17515, 17518, 17521, 17524,
+    17527, 17530, 17533, 17536, 17539, 17542, 17545, 17548, 17551, 17554,
+    17557, 17560, 17563, 17566, 17569, 17572, 17575, 17578, 17581, 17584,
+    17587, 17590, 17593, 17596, 17599, 17602, 17605, 17608, 17611, 17614,
+    17617, 17620, 17623, 17626, 17629, 17632, 17635, 17638, 17641, 17644,
+    17647, 17650, 17653, 17656, 17659, 17662, 17665, 17668, 17671, 17674,
+    17677, 17680, 17683, 17686, 17689, 17692, 17695, 17698, 17701, 17704,
+    17707, 17710, 17713, 17716, 17719, 17722, 17725, 17728, 17731, 17734,
+    17737, 17740, 17743, 17746, 17749, 17752, 17755, 17758, 17761, 17764,
+    17767, 17770, 17773, 17776, 17779, 17782, 17785, 17788, 17791, 17794,
+    17797, 17800, 17803, 17806, 17809, 17812, 17815, 17818, 17821, 17824,
+    17827, 17830, 17833, 17836, 17839, 17842, 17845, 17848, 17851, 17854,
+    17857, 17860, 17863, 17866, 17869, 17872, 17875, 17878, 17881, 17884,
+    17887, 17890, 17893, 17896, 17899, 17902, 17905, 17908, 17911, 17914,
+    17917, 17920, 17923, 17926, 17929, 17932, 17935, 17938, 17941, 17944,
+    17947, 17950, 17953, 17956, 17959, 17962, 17965, 17968, 17971, 17974,
+    17977, 17980, 17983, 17986, 17989, 17992, 17995, 17998, 18001, 18004,
+    18007, 18010, 18013, 18016, 18019, 18022, 18025, 18028, 18031, 18034,
+    18037, 18040, 18043, 18046, 18049, 18052, 18055, 18058, 18061, 18064,
+    18067, 18070, 18073, 18076, 18079, 18082, 18085, 18088, 18091, 18094,
+    18097, 18100, 18103, 18106, 18109, 18112, 18115, 18118, 18121, 18124,
+    18127, 18130, 18133, 18136, 18139, 18142, 18145, 18148, 18151, 18154,
+    18157, 18160, 18163, 18166, 18169, 18172, 18175, 18178, 18181, 18184,
+    18187, 18190, 18193, 18196, 18199, 18202, 18205, 18208, 18211, 18214,
+    18217, 18220, 18223, 18226, 18229, 18232, 18235, 18238, 18241, 18244,
+    18247, 18250, 18253, 18256, 18259, 18262, 18265, 18268, 18271, 18274,
+    18277, 18280, 18283, 18286, 18289, 18292, 18295, 18298, 18301, 18304,
+    18307, 18310, 18313, 18316, 18319, 18322, 18325, 18328, 18331, 18334,
+    18337, 18340, 18343, 18346, 18349, 18352, 18355, 18358, 18361, 18364,
+    18367, 18370, 18373, 18376, 18379, 18382, 18385, 18388, 18391, 18394,
+    18397, 18400, 18403, 18406, 18409, 18412, 18415, 18418, 18421, 18424,
+    18427, 18430, 18433, 18436, 18439, 18442, 18445, 18448, 18451, 18454,
+    18457, 18460, 18463, 18466, 18469, 18472, 18475, 18478, 18481, 18484,
+    18487, 18490, 18493, 18496, 18499, 18502, 18505, 18508, 18511, 18514,
+    18517, 18520, 18523, 18526, 18529, 18532, 18535, 18538, 18541, 18544,
+    18547, 18550, 18553, 18556, 18559, 18562, 18565, 18568, 18571, 18574,
+    18577, 18580, 18583, 18586, 18589, 18592, 18595, 18598, 18601, 18604,
+    18607, 18610, 18613, 18616, 18619, 18622, 18625, 18628, 18631, 18634,
+    18637, 18640, 18643, 18646, 18649, 18652, 18655, 18658, 18661, 18664,
+    18667, 18670, 18673, 18676, 18679, 18682, 18685, 18688, 18691, 18694,
+    18697, 18700, 18703, 18706, 18709, 18712, 18715, 18718, 18721, 18724,
+    18727, 18730, 18733, 18736, 18739, 18742, 18745, 18748, 18751, 18754,
+    18757, 18760, 18763, 18766, 18769, 18772, 18775, 18778, 18781, 18784,
+    18787, 18790, 18793, 18796, 18799, 18802, 18805, 18808, 18811, 18814,
+    18817, 18820, 18823, 18826, 18829, 18832, 18835, 18838, 18841, 18844,
+    18847, 18850, 18853, 18856, 18859, 18862, 18865, 18868, 18871, 18874,
+    18877, 18880, 18883, 18886, 18889, 18892, 18895, 18898, 18901, 18904,
+    18907, 18910, 18913, 18916, 18919, 18922, 18925, 18928, 18931, 18934,
+    18937, 18940, 18943, 18946, 18949, 18952, 18955, 18958, 18961, 18964,
+    18967, 18970, 18973, 18976, 18979, 18982, 18985, 18988, 18991, 18994,
+    18997, 19000, 19003, 19006, 19009, 19012, 19015, 19018, 19021, 19024,
+    19027, 19030, 19033, 19036, 19039, 19042, 19045, 19048, 19051, 19054,
+    19057, 19060, 19063, 19066, 19069, 19072, 19075, 19078, 19081, 19084,
+    19087, 19090, 19093, 19096, 19099, 19102, 19105, 19108, 19111, 19114,
+    19117, 19120, 19123, 19126, 19129, 19132, 19135, 19138, 19141, 19144,
+    19147, 19150, 19153, 19156, 19159, 19162, 19165, 19168, 19171, 19174,
+    19177, 19180, 19183, 19186, 19189, 19192, 19195, 19198, 19201, 19204,
+    19207, 19210, 19213, 19216, 19219, 19222, 19225, 19228, 19231, 19234,
+    19237, 19240, 19243, 19246, 19249, 19252, 19255, 19258, 19261, 19264,
+    19267, 19270, 19273, 19276, 19279, 19282, 19285, 19288, 19291, 19294,
+    19297, 19300, 19303, 19306, 19309, 19312, 19315, 19318, 19321, 19324,
+    19327, 19330, 19333, 19336, 19339, 19342, 19345, 19348, 19351, 19354,
+    19357, 19360, 19363, 19366, 19369, 19372, 19375, 19378, 19381, 19384,
+    19387, 19390, 19393, 19396, 19399, 19402, 19405, 19408, 19411, 19414,
+    19417, 19420, 19423, 19426, 19429, 19432, 19435, 19438, 19441, 19444,
+    19447, 19450, 19453, 19456, 19459, 19462, 19465, 19468, 19471, 19474,
+    19477, 19480, 19483, 19486, 19489, 19492, 19495, 19498, 19501, 19504,
+    19507, 19510, 19513, 19516, 19519, 19522, 19525, 19528, 19531, 19534,
+    19537, 19540, 19543, 19546, 19549, 19552, 19555, 19558, 19561, 19564,
+    19567, 19570, 19573, 19576, 19579, 19582, 19585, 19588, 19591, 19594,
+    19597, 19600, 19603, 19606, 19609, 19612, 19615, 19618, 19621, 19624,
+    19627, 19630, 19633, 19636, 19639, 19642, 19645, 19648, 19651, 19654,
+    19657, 19660, 19663, 19666, 19669, 19672, 19675, 19678, 19681, 19684,
+    19687, 19690, 19693, 19696, 19699, 19702, 19705, 19708, 19711, 19714,
+    19717, 19720, 19723, 19726, 19729, 19732, 19735, 19738, 19741, 19744,
+    19747, 19750, 19753, 19756, 19759, 19762, 19765, 19768, 19771, 19774,
+    19777, 19780, 19783, 19786, 19789, 19792, 19795, 19798, 19801, 19804,
+    19807, 19810, 19813, 19816, 19819, 19822, 19825, 19828, 19831, 19834,
+    19837, 19840, 19843, 19846, 19849, 19852, 19855, 19858, 19861, 19864,
+    19867, 19870, 19873, 19876, 19879, 19882, 19885, 19888, 19891, 19894,
+    19897, 19900, 19903, 19906, 19909, 19912, 19915, 19918, 19921, 19924,
+    19927, 19930, 19933, 19936, 19939, 19942, 19945, 19948, 19951, 19954,
+    19957, 19960, 19963, 19966, 19969, 19972, 19975, 19978, 19981, 19984,
+    19987, 19990, 19993, 19996, 19999, 20002, 20005, 20008, 20011, 20014,
+    20017, 20020, 20023, 20026, 20029, 20032, 20035, 20038, 20041, 20044,
+    20047, 20050, 20053, 20056, 20059, 20062, 20065, 20068, 20071, 20074,
+    20077, 20080, 20083, 20086, 20089, 20092, 20095, 20098, 20101, 20104,
+    20107, 20110, 20113, 20116, 20119, 20122, 20125, 20128, 20131, 20134,
+    20137, 20140, 20143, 20146, 20149, 20152, 20155, 20158, 20161, 20164,
+    20167, 20170, 20173, 20176, 20179, 20182, 20185, 20188, 20191, 20194,
+    20197, 20200, 20203, 20206, 20209, 20212, 20215, 20218, 20221, 20224,
+    20227, 20230, 20233, 20236, 20239, 20242, 20245, 20248, 20251, 20254,
+    20257, 20260, 20263, 20266, 20269, 20272, 20275, 20278, 20281, 20284,
+    20287, 20290, 20293, 20296, 20299, 20302, 20305, 20308, 20311, 20314,
+    20317, 20320, 20323, 20326, 20329, 20332
+};
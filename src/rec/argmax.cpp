@@ -0,0 +1,468 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "argmax.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ARGMAX_USE_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ARGMAX_USE_NEON
+#endif
+
+// AVX2/AVX-512 kernels are compiled with per-function target attributes and
+// only called after checking the CPU, the rest of the build stays at the
+// baseline instruction set.
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define ARGMAX_USE_DISPATCH
+#define ARGMAX_TARGET(isa) __attribute__((target(isa)))
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#define ARGMAX_USE_DISPATCH
+#define ARGMAX_TARGET(isa)
+#endif
+
+typedef int (*ArgmaxKernel)(const float* data, int n, float* value);
+
+static int LowestBit(unsigned int mask) {
+  int bit = 0;
+  while (((mask >> bit) & 1) == 0) bit++;
+  return bit;
+}
+
+// Every kernel takes the max first and then looks for its first position,
+// the second pass usually stops early and keeps the tie order of the
+// scalar scan without tracking indices per lane.
+static int ArgmaxScalar(const float* data, int n, float* value) {
+  int index = 0;
+  float max_value = data[0];
+  for (int i = 1; i < n; i++) {
+    if (data[i] > max_value) {
+      max_value = data[i];
+      index = i;
+    }
+  }
+  *value = max_value;
+  return index;
+}
+
+#if defined(ARGMAX_USE_SSE2)
+static int ArgmaxSSE2(const float* data, int n, float* value) {
+  float max_value = data[0];
+  int i = 0;
+  if (n >= 16) {
+    __m128 m0 = _mm_loadu_ps(data);
+    __m128 m1 = _mm_loadu_ps(data + 4);
+    __m128 m2 = _mm_loadu_ps(data + 8);
+    __m128 m3 = _mm_loadu_ps(data + 12);
+    for (i = 16; i + 16 <= n; i += 16) {
+      m0 = _mm_max_ps(m0, _mm_loadu_ps(data + i));
+      m1 = _mm_max_ps(m1, _mm_loadu_ps(data + i + 4));
+      m2 = _mm_max_ps(m2, _mm_loadu_ps(data + i + 8));
+      m3 = _mm_max_ps(m3, _mm_loadu_ps(data + i + 12));
+    }
+    __m128 m = _mm_max_ps(_mm_max_ps(m0, m1), _mm_max_ps(m2, m3));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    max_value = _mm_cvtss_f32(m);
+  }
+  for (; i < n; i++) {
+    if (data[i] > max_value) max_value = data[i];
+  }
+  *value = max_value;
+
+  const __m128 target = _mm_set1_ps(max_value);
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + j), target));
+    if (mask != 0) return j + LowestBit(mask);
+  }
+  for (; j < n; j++) {
+    if (data[j] == max_value) return j;
+  }
+  // NaN in the row, fall back to the scalar order
+  return ArgmaxScalar(data, n, value);
+}
+#endif
+
+#if defined(ARGMAX_USE_NEON)
+static int ArgmaxNEON(const float* data, int n, float* value) {
+  float max_value = data[0];
+  int i = 0;
+  if (n >= 16) {
+    float32x4_t m0 = vld1q_f32(data);
+    float32x4_t m1 = vld1q_f32(data + 4);
+    float32x4_t m2 = vld1q_f32(data + 8);
+    float32x4_t m3 = vld1q_f32(data + 12);
+    for (i = 16; i + 16 <= n; i += 16) {
+      m0 = vmaxq_f32(m0, vld1q_f32(data + i));
+      m1 = vmaxq_f32(m1, vld1q_f32(data + i + 4));
+      m2 = vmaxq_f32(m2, vld1q_f32(data + i + 8));
+      m3 = vmaxq_f32(m3, vld1q_f32(data + i + 12));
+    }
+    max_value = vmaxvq_f32(vmaxq_f32(vmaxq_f32(m0, m1), vmaxq_f32(m2, m3)));
+  }
+  for (; i < n; i++) {
+    if (data[i] > max_value) max_value = data[i];
+  }
+  *value = max_value;
+
+  const float32x4_t target = vdupq_n_f32(max_value);
+  int j = 0;
+  for (; j + 4 <= n; j += 4) {
+    if (vmaxvq_u32(vceqq_f32(vld1q_f32(data + j), target)) == 0) continue;
+    for (int k = 0; k < 4; k++) {
+      if (data[j + k] == max_value) return j + k;
+    }
+  }
+  for (; j < n; j++) {
+    if (data[j] == max_value) return j;
+  }
+  return ArgmaxScalar(data, n, value);
+}
+#endif
+
+#if defined(ARGMAX_USE_DISPATCH)
+ARGMAX_TARGET("avx2")
+static int ArgmaxAVX2(const float* data, int n, float* value) {
+  float max_value = data[0];
+  int i = 0;
+  if (n >= 32) {
+    __m256 m0 = _mm256_loadu_ps(data);
+    __m256 m1 = _mm256_loadu_ps(data + 8);
+    __m256 m2 = _mm256_loadu_ps(data + 16);
+    __m256 m3 = _mm256_loadu_ps(data + 24);
+    for (i = 32; i + 32 <= n; i += 32) {
+      m0 = _mm256_max_ps(m0, _mm256_loadu_ps(data + i));
+      m1 = _mm256_max_ps(m1, _mm256_loadu_ps(data + i + 8));
+      m2 = _mm256_max_ps(m2, _mm256_loadu_ps(data + i + 16));
+      m3 = _mm256_max_ps(m3, _mm256_loadu_ps(data + i + 24));
+    }
+    __m256 m8 = _mm256_max_ps(_mm256_max_ps(m0, m1), _mm256_max_ps(m2, m3));
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(m8),
+                          _mm256_extractf128_ps(m8, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    max_value = _mm_cvtss_f32(m);
+  }
+  for (; i < n; i++) {
+    if (data[i] > max_value) max_value = data[i];
+  }
+  *value = max_value;
+
+  const __m256 target = _mm256_set1_ps(max_value);
+  int j = 0;
+  for (; j + 8 <= n; j += 8) {
+    int mask = _mm256_movemask_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(data + j), target, _CMP_EQ_OQ));
+    if (mask != 0) return j + LowestBit(mask);
+  }
+  for (; j < n; j++) {
+    if (data[j] == max_value) return j;
+  }
+  return ArgmaxScalar(data, n, value);
+}
+
+ARGMAX_TARGET("avx512f")
+static int ArgmaxAVX512(const float* data, int n, float* value) {
+  float max_value = data[0];
+  int i = 0;
+  if (n >= 64) {
+    __m512 m0 = _mm512_loadu_ps(data);
+    __m512 m1 = _mm512_loadu_ps(data + 16);
+    __m512 m2 = _mm512_loadu_ps(data + 32);
+    __m512 m3 = _mm512_loadu_ps(data + 48);
+    for (i = 64; i + 64 <= n; i += 64) {
+      m0 = _mm512_max_ps(m0, _mm512_loadu_ps(data + i));
+      m1 = _mm512_max_ps(m1, _mm512_loadu_ps(data + i + 16));
+      m2 = _mm512_max_ps(m2, _mm512_loadu_ps(data + i + 32));
+      m3 = _mm512_max_ps(m3, _mm512_loadu_ps(data + i + 48));
+    }
+    max_value = _mm512_reduce_max_ps(
+        _mm512_max_ps(_mm512_max_ps(m0, m1), _mm512_max_ps(m2, m3)));
+  }
+  for (; i < n; i++) {
+    if (data[i] > max_value) max_value = data[i];
+  }
+  *value = max_value;
+
+  const __m512 target = _mm512_set1_ps(max_value);
+  int j = 0;
+  for (; j + 16 <= n; j += 16) {
+    unsigned int mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(data + j), target,
+                                           _CMP_EQ_OQ);
+    if (mask != 0) return j + LowestBit(mask);
+  }
+  for (; j < n; j++) {
+    if (data[j] == max_value) return j;
+  }
+  return ArgmaxScalar(data, n, value);
+}
+
+#if defined(_MSC_VER)
+// CPU and OS support of the register state, cpuid bits alone are not enough
+static bool CpuSupports(int leaf7_ebx_bit, unsigned int xcr0_mask) {
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) return false;
+  __cpuid(info, 1);
+  // OSXSAVE and AVX
+  if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) return false;
+  if ((_xgetbv(0) & xcr0_mask) != xcr0_mask) return false;
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << leaf7_ebx_bit)) != 0;
+}
+static bool CpuHasAVX2() { return CpuSupports(5, 0x6); }
+static bool CpuHasAVX512F() { return CpuSupports(16, 0xE6); }
+#else
+static bool CpuHasAVX2() { return __builtin_cpu_supports("avx2"); }
+static bool CpuHasAVX512F() { return __builtin_cpu_supports("avx512f"); }
+#endif
+#endif
+
+struct ArgmaxDispatch {
+  ArgmaxKernel kernel;
+  const char* name;
+};
+
+static ArgmaxDispatch SelectKernel() {
+#if defined(ARGMAX_USE_DISPATCH)
+  if (CpuHasAVX512F()) return ArgmaxDispatch{ArgmaxAVX512, "avx512f"};
+  if (CpuHasAVX2()) return ArgmaxDispatch{ArgmaxAVX2, "avx2"};
+#endif
+#if defined(ARGMAX_USE_SSE2)
+  return ArgmaxDispatch{ArgmaxSSE2, "sse2"};
+#elif defined(ARGMAX_USE_NEON)
+  return ArgmaxDispatch{ArgmaxNEON, "neon"};
+#else
+  return ArgmaxDispatch{ArgmaxScalar, "scalar"};
+#endif
+}
+
+static const ArgmaxDispatch& Dispatch() {
+  static const ArgmaxDispatch dispatch = SelectKernel();
+  return dispatch;
+}
+
+void Argmax(const float* data, int n, int* index, float* value) {
+  if (n <= 0) {
+    *index = 0;
+    *value = 0.0f;
+    return;
+  }
+  *index = Dispatch().kernel(data, n, value);
+}
+
+void ArgmaxRows(const float* data, int rows, int cols, size_t row_stride,
+                int* indices, float* values) {
+  if (cols <= 0) {
+    for (int r = 0; r < rows; r++) {
+      indices[r] = 0;
+      if (values != NULL) values[r] = 0.0f;
+    }
+    return;
+  }
+  ArgmaxKernel kernel = Dispatch().kernel;
+  for (int r = 0; r < rows; r++) {
+    float value;
+    indices[r] = kernel(data + r * row_stride, cols, &value);
+    if (values != NULL) values[r] = value;
+  }
+}
+
+// exp(x) for x <= 0 as 2^n * 2^f with f in [-0.5, 0.5] and a degree 6
+// Taylor polynomial of 2^f. Inputs below -87 flush to about 1e-38.
+static const float kExpMin = -87.0f;
+static const float kLog2e = 1.44269504f;
+static const float kExpPoly[7] = {1.0f,        0.693147181f, 0.240226507f,
+                                  0.055504109f, 0.009618129f, 0.001333356f,
+                                  0.000154035f};
+
+static float SumExpScalar(const float* data, int n, float max_value) {
+  float sum = 0.0f;
+  for (int i = 0; i < n; i++) {
+    sum += std::exp(std::max(data[i] - max_value, kExpMin));
+  }
+  return sum;
+}
+
+#if defined(ARGMAX_USE_SSE2)
+static float SumExpSSE2(const float* data, int n, float max_value) {
+  const __m128 max4 = _mm_set1_ps(max_value);
+  const __m128 min4 = _mm_set1_ps(kExpMin);
+  const __m128 log2e = _mm_set1_ps(kLog2e);
+  __m128 sum4 = _mm_setzero_ps();
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 x = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(data + i), max4), min4);
+    __m128 t = _mm_mul_ps(x, log2e);
+    __m128i k = _mm_cvtps_epi32(t);
+    __m128 f = _mm_sub_ps(t, _mm_cvtepi32_ps(k));
+    __m128 p = _mm_set1_ps(kExpPoly[6]);
+    for (int j = 5; j >= 0; j--) {
+      p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(kExpPoly[j]));
+    }
+    __m128 scale = _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_add_epi32(k, _mm_set1_epi32(127)), 23));
+    sum4 = _mm_add_ps(sum4, _mm_mul_ps(p, scale));
+  }
+  float lanes[4];
+  _mm_storeu_ps(lanes, sum4);
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+         SumExpScalar(data + i, n - i, max_value);
+}
+#elif defined(ARGMAX_USE_NEON)
+static float SumExpNEON(const float* data, int n, float max_value) {
+  const float32x4_t max4 = vdupq_n_f32(max_value);
+  const float32x4_t min4 = vdupq_n_f32(kExpMin);
+  float32x4_t sum4 = vdupq_n_f32(0.0f);
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t x = vmaxq_f32(vsubq_f32(vld1q_f32(data + i), max4), min4);
+    float32x4_t t = vmulq_n_f32(x, kLog2e);
+    int32x4_t k = vcvtnq_s32_f32(t);
+    float32x4_t f = vsubq_f32(t, vcvtq_f32_s32(k));
+    float32x4_t p = vdupq_n_f32(kExpPoly[6]);
+    for (int j = 5; j >= 0; j--) {
+      p = vmlaq_f32(vdupq_n_f32(kExpPoly[j]), p, f);
+    }
+    float32x4_t scale = vreinterpretq_f32_s32(
+        vshlq_n_s32(vaddq_s32(k, vdupq_n_s32(127)), 23));
+    sum4 = vaddq_f32(sum4, vmulq_f32(p, scale));
+  }
+  return vaddvq_f32(sum4) + SumExpScalar(data + i, n - i, max_value);
+}
+#endif
+
+float LogSumExp(const float* data, int n, float max_value) {
+#if defined(ARGMAX_USE_SSE2)
+  float sum = SumExpSSE2(data, n, max_value);
+#elif defined(ARGMAX_USE_NEON)
+  float sum = SumExpNEON(data, n, max_value);
+#else
+  float sum = SumExpScalar(data, n, max_value);
+#endif
+  return max_value + std::log(sum);
+}
+
+static float MaxScalar(const float* data, int n) {
+  float max_value = data[0];
+  for (int i = 1; i < n; i++) {
+    if (data[i] > max_value) max_value = data[i];
+  }
+  return max_value;
+}
+
+#if defined(ARGMAX_USE_SSE2)
+static float MaxSSE2(const float* data, int n) {
+  if (n < 4) return MaxScalar(data, n);
+  __m128 m = _mm_loadu_ps(data);
+  int i = 4;
+  for (; i + 4 <= n; i += 4) {
+    m = _mm_max_ps(m, _mm_loadu_ps(data + i));
+  }
+  m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+  m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+  float max_value = _mm_cvtss_f32(m);
+  for (; i < n; i++) {
+    if (data[i] > max_value) max_value = data[i];
+  }
+  return max_value;
+}
+#elif defined(ARGMAX_USE_NEON)
+static float MaxNEON(const float* data, int n) {
+  if (n < 4) return MaxScalar(data, n);
+  float32x4_t m = vld1q_f32(data);
+  int i = 4;
+  for (; i + 4 <= n; i += 4) {
+    m = vmaxq_f32(m, vld1q_f32(data + i));
+  }
+  float max_value = vmaxvq_f32(m);
+  for (; i < n; i++) {
+    if (data[i] > max_value) max_value = data[i];
+  }
+  return max_value;
+}
+#endif
+
+static const float kNegInfinity = -std::numeric_limits<float>::infinity();
+
+float LogSumExp(const float* data, int n) {
+  // blocks small enough to stay in L1 between their max and their sum, so
+  // the row is read from memory once
+  const int kBlock = 64;
+  float max_value = kNegInfinity;
+  float sum = 0.0f;
+  for (int i = 0; i < n; i += kBlock) {
+    int count = std::min(kBlock, n - i);
+#if defined(ARGMAX_USE_SSE2)
+    float block_max = MaxSSE2(data + i, count);
+#elif defined(ARGMAX_USE_NEON)
+    float block_max = MaxNEON(data + i, count);
+#else
+    float block_max = MaxScalar(data + i, count);
+#endif
+    if (block_max == kNegInfinity) continue;
+    if (block_max > max_value) {
+      sum *= std::exp(max_value - block_max);
+      max_value = block_max;
+    }
+#if defined(ARGMAX_USE_SSE2)
+    sum += SumExpSSE2(data + i, count, max_value);
+#elif defined(ARGMAX_USE_NEON)
+    sum += SumExpNEON(data + i, count, max_value);
+#else
+    sum += SumExpScalar(data + i, count, max_value);
+#endif
+  }
+  if (max_value == kNegInfinity) return max_value;
+  return max_value + std::log(sum);
+}
+
+const char* ArgmaxKernelName() { return Dispatch().name; }
+
+static const std::vector<ArgmaxDispatch>& AllKernels() {
+  static const std::vector<ArgmaxDispatch> kernels = [] {
+    std::vector<ArgmaxDispatch> all;
+    all.push_back(ArgmaxDispatch{ArgmaxScalar, "scalar"});
+#if defined(ARGMAX_USE_SSE2)
+    all.push_back(ArgmaxDispatch{ArgmaxSSE2, "sse2"});
+#elif defined(ARGMAX_USE_NEON)
+    all.push_back(ArgmaxDispatch{ArgmaxNEON, "neon"});
+#endif
+#if defined(ARGMAX_USE_DISPATCH)
+    if (CpuHasAVX2()) all.push_back(ArgmaxDispatch{ArgmaxAVX2, "avx2"});
+    if (CpuHasAVX512F()) {
+      all.push_back(ArgmaxDispatch{ArgmaxAVX512, "avx512f"});
+    }
+#endif
+    return all;
+  }();
+  return kernels;
+}
+
+int NumArgmaxKernels() { return int(AllKernels().size()); }
+
+const char* ArgmaxKernelNameAt(int kernel) {
+  return AllKernels()[kernel].name;
+}
+
+void ArgmaxWithKernel(int kernel, const float* data, int n, int* index,
+                      float* value) {
+  if (n <= 0) {
+    *index = 0;
+    *value = 0.0f;
+    return;
+  }
+  *index = AllKernels()[kernel].kernel(data, n, value);
+}
@@ -0,0 +1,36 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <cstddef>
+
+// Index and value of the largest of the n floats at data, the first index
+// on ties like a scalar `>` scan. The kernel is picked once at runtime from
+// AVX-512, AVX2, SSE2 or NEON, whatever the CPU supports.
+void Argmax(const float* data, int n, int* index, float* value);
+
+// Argmax of every row of a rows x cols matrix whose rows start row_stride
+// floats apart. A line n of the T x N x C recognizer output is one call on
+// data + n * C with row_stride N * C. indices/values get rows entries,
+// values may be NULL.
+void ArgmaxRows(const float* data, int rows, int cols, size_t row_stride,
+                int* indices, float* values);
+
+// log(sum(exp(data[i]))) of n floats whose max is max_value, the softmax
+// normalizer of a row of logits. exp is a vectorized polynomial with a
+// relative error below 1e-6.
+float LogSumExp(const float* data, int n, float max_value);
+// The same when the max is not known, in a single pass over the row that
+// tracks the max block by block and rescales the sum when it grows.
+float LogSumExp(const float* data, int n);
+
+// Name of the kernel Argmax dispatches to, for logging.
+const char* ArgmaxKernelName();
+
+// The kernels compiled in that this CPU can run, the scalar reference
+// first, so tests can compare each of them with it.
+int NumArgmaxKernels();
+const char* ArgmaxKernelNameAt(int kernel);
+void ArgmaxWithKernel(int kernel, const float* data, int n, int* index,
+                      float* value);
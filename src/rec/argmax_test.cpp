@@ -0,0 +1,135 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+// Compares every argmax kernel this CPU runs with the scalar reference, and
+// the polynomial LogSumExp with a double precision one.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "common/test_check.h"
+#include "rec/argmax.h"
+
+static const float kInf = std::numeric_limits<float>::infinity();
+
+// Widths around every vector and unroll size, and the alphabet size.
+static const int kWidths[] = {1,  2,  3,  4,  5,  7,  8,  9,  15,  16,  17,
+                              31, 32, 33, 63, 64, 65, 127, 129, 1000, 6625};
+
+static void RandomRow(std::mt19937& rng, int n, int pattern,
+                      std::vector<float>& row) {
+  std::normal_distribution<float> normal(0.0f, 4.0f);
+  std::uniform_int_distribution<int> pick(0, n - 1);
+  row.resize(n);
+  for (float& v : row) v = normal(rng);
+  if (pattern == 1) {
+    // ties: the max repeated at several positions
+    float max_value = 100.0f;
+    for (int k = 0; k < 3; k++) row[pick(rng)] = max_value;
+  } else if (pattern == 2) {
+    // masked classes
+    for (int k = 0; k < n / 2; k++) row[pick(rng)] = -kInf;
+  } else if (pattern == 3) {
+    for (float& v : row) v = -kInf;
+  } else if (pattern == 4) {
+    // few distinct values, ties everywhere
+    for (float& v : row) v = float(int(v) % 3);
+  }
+}
+
+static void TestArgmaxKernels() {
+  std::mt19937 rng(7);
+  std::vector<float> row;
+  for (int kernel = 0; kernel < NumArgmaxKernels(); kernel++) {
+    const char* name = ArgmaxKernelNameAt(kernel);
+    printf("argmax kernel %s\n", name);
+    for (int n : kWidths) {
+      for (int pattern = 0; pattern < 5; pattern++) {
+        for (int trial = 0; trial < 20; trial++) {
+          RandomRow(rng, n, pattern, row);
+          // unaligned starts as well
+          int offset = trial % 3;
+          std::vector<float> shifted(offset, 0.0f);
+          shifted.insert(shifted.end(), row.begin(), row.end());
+          const float* data = shifted.data() + offset;
+          int ref_index;
+          float ref_value;
+          ArgmaxWithKernel(0, data, n, &ref_index, &ref_value);
+          int index;
+          float value;
+          ArgmaxWithKernel(kernel, data, n, &index, &value);
+          EXPECT(index == ref_index && value == ref_value,
+                 "%s n=%d pattern=%d: %d/%g, scalar %d/%g", name, n, pattern,
+                 index, value, ref_index, ref_value);
+        }
+      }
+    }
+  }
+
+  // ArgmaxRows on a strided T x N x C layout, line 1 of 3
+  const int rows = 25;
+  const int cols = 37;
+  const int lines = 3;
+  std::vector<float> data(rows * lines * cols);
+  std::normal_distribution<float> normal(0.0f, 4.0f);
+  for (float& v : data) v = normal(rng);
+  std::vector<int> indices(rows);
+  std::vector<float> values(rows);
+  ArgmaxRows(data.data() + cols, rows, cols, lines * cols, indices.data(),
+             values.data());
+  for (int r = 0; r < rows; r++) {
+    int ref_index;
+    float ref_value;
+    ArgmaxWithKernel(0, data.data() + cols + r * lines * cols, cols,
+                     &ref_index, &ref_value);
+    EXPECT(indices[r] == ref_index && values[r] == ref_value,
+           "ArgmaxRows row %d", r);
+  }
+}
+
+static double ReferenceLogSumExp(const float* data, int n) {
+  double max_value = -kInf;
+  for (int i = 0; i < n; i++) max_value = std::max(max_value, double(data[i]));
+  if (max_value == -kInf) return max_value;
+  double sum = 0.0;
+  for (int i = 0; i < n; i++) sum += std::exp(data[i] - max_value);
+  return max_value + std::log(sum);
+}
+
+static void TestLogSumExp() {
+  std::mt19937 rng(11);
+  std::vector<float> row;
+  for (int n : kWidths) {
+    for (int pattern = 0; pattern < 5; pattern++) {
+      if (pattern == 3) continue;
+      for (int trial = 0; trial < 20; trial++) {
+        RandomRow(rng, n, pattern, row);
+        int index;
+        float max_value;
+        Argmax(row.data(), n, &index, &max_value);
+        double expected = ReferenceLogSumExp(row.data(), n);
+        float with_max = LogSumExp(row.data(), n, max_value);
+        float fused = LogSumExp(row.data(), n);
+        double tolerance = 1e-5 * std::max(1.0, std::fabs(expected));
+        EXPECT(std::fabs(with_max - expected) <= tolerance,
+               "n=%d pattern=%d: %g, expected %g", n, pattern, with_max,
+               expected);
+        EXPECT(std::fabs(fused - expected) <= tolerance,
+               "fused n=%d pattern=%d: %g, expected %g", n, pattern, fused,
+               expected);
+      }
+    }
+  }
+  row.assign(40, -kInf);
+  EXPECT(LogSumExp(row.data(), int(row.size())) == -kInf,
+         "a masked row normalizes to -inf");
+}
+
+int main() {
+  TestArgmaxKernels();
+  TestLogSumExp();
+  return TestResult();
+}
@@ -0,0 +1,58 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "class_subset.h"
+#include <algorithm>
+
+ClassSubset::ClassSubset(const std::vector<int>& labels)
+    : has_grammar_(false) {
+  SetLabels(labels);
+}
+
+ClassSubset::ClassSubset(const FieldGrammar& grammar) : has_grammar_(true) {
+  SetLabels(grammar.Labels());
+  // the same automaton with every label replaced by its subset index
+  for (int state = 1; state < grammar.num_states(); state++) {
+    grammar_.AddState();
+  }
+  for (int state = 0; state < grammar.num_states(); state++) {
+    for (const FieldGrammar::Arc& arc : grammar.arcs(state)) {
+      int index = int(std::lower_bound(classes_.begin(), classes_.end(),
+                                       arc.label) -
+                      classes_.begin());
+      grammar_.AddArc(state, index, arc.next);
+    }
+    if (grammar.accepting(state)) grammar_.Accept(state);
+  }
+}
+
+void ClassSubset::SetLabels(const std::vector<int>& labels) {
+  classes_.assign(1, 0);
+  for (int label : labels) {
+    if (label > 0) classes_.push_back(label);
+  }
+  std::sort(classes_.begin() + 1, classes_.end());
+  classes_.erase(std::unique(classes_.begin(), classes_.end()),
+                 classes_.end());
+}
+
+void ClassSubset::Gather(const float* logits, int num_steps,
+                         size_t step_stride, float* out) const {
+  const int* classes = classes_.data();
+  int count = size();
+  for (int t = 0; t < num_steps; t++) {
+    const float* row = logits + t * step_stride;
+    for (int k = 0; k < count; k++) {
+      out[k] = row[classes[k]];
+    }
+    out += count;
+  }
+}
+
+void ClassSubset::ToAlphabet(RecResult& result) const {
+  for (int& label : result.labels) {
+    label = classes_[label];
+  }
+  LabelsToText(result);
+}
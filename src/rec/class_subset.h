@@ -0,0 +1,46 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "decode.h"
+#include "field_grammar.h"
+
+// The classes a line is decoded from when its characters are known in
+// advance, e.g. the digits and X of an ID number. Only these columns of
+// the logits are gathered and the beam search runs over a dozen columns
+// instead of the whole alphabet. The softmax normalizer still comes from
+// the full rows, so probabilities stay posteriors over the whole alphabet
+// and a crop showing other characters reads with low confidence.
+class ClassSubset {
+ public:
+  // labels of the alphabet, the blank is always included
+  explicit ClassSubset(const std::vector<int>& labels);
+  // The labels the grammar uses, decoding follows the grammar.
+  explicit ClassSubset(const FieldGrammar& grammar);
+
+  int size() const { return int(classes_.size()); }
+  // The blank first, then the labels ascending.
+  const std::vector<int>& classes() const { return classes_; }
+  // The grammar over subset indices, nullptr when built from labels.
+  const FieldGrammar* grammar() const {
+    return has_grammar_ ? &grammar_ : nullptr;
+  }
+
+  // Copies the subset columns of num_steps rows of logits, step_stride
+  // floats apart, into num_steps x size() floats.
+  void Gather(const float* logits, int num_steps, size_t step_stride,
+              float* out) const;
+  // Maps the labels of a result decoded over the subset back to alphabet
+  // labels and sets its text.
+  void ToAlphabet(RecResult& result) const;
+
+ private:
+  void SetLabels(const std::vector<int>& labels);
+
+  std::vector<int> classes_;
+  bool has_grammar_;
+  FieldGrammar grammar_;
+};
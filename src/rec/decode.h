@@ -4,7 +4,104 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <unordered_map>
 #include <vector>
-extern std::vector<std::string> alphabets;
+#include "field_grammar.h"
 std::vector<int> GreedyDecode(const std::vector<int> &preds);
+
+// Number of characters of the recognizer alphabet. Labels run from 1 to
+// AlphabetSize(), 0 is the blank.
+int AlphabetSize();
+// The UTF-8 bytes of a label, *size of them at the returned pointer. The
+// alphabet is constant data (alphabet_table.h), nothing is copied.
+const char *AlphabetChar(int label, size_t *size);
+
+// A recognized line. labels are the decoded classes (AlphabetChar of
+// each), char_probs holds the posterior of every label and score is the log
+// probability of the sequence: the argmax path for greedy decoding, the sum
+// over all alignments for the beam search. Decoded under a grammar, accepted
+// is false when no beam reached an accepting state, the result is then
+// empty rather than a value the grammar does not allow.
+struct RecResult {
+  std::string text;
+  std::vector<int> labels;
+  std::vector<float> char_probs;
+  float score = 0.0f;
+  bool accepted = true;
+};
+
+struct CTCDecodeConfig {
+  // 1 decodes greedily from the argmax, larger runs a prefix beam search
+  int beam_width = 1;
+  // classes tried per timestep by the beam search
+  int top_k = 8;
+  // classes whose log probability is below this are never tried
+  float min_log_prob = -12.0f;
+  // beam width of lines decoded under a field grammar, a wider beam keeps
+  // more valid candidates alive until the end of the line
+  int grammar_beam_width = 8;
+};
+
+// Log-softmax normalizers of a line, log_norms[t] = log(sum(exp(row t)))
+// with max_logits the max of every row as returned by ArgmaxRows. When
+// max_logits is NULL every row is normalized in one pass without it.
+void LogSoftmaxNorms(const float *logits, int num_steps, int num_classes,
+                     size_t step_stride, const float *max_logits,
+                     float *log_norms);
+
+// Greedy CTC decode of a line from its argmax path. The log posterior of
+// class c at step t is logits[t * step_stride + c] - log_norms[t]; the
+// normalizers may come from wider rows than the logits decoded, e.g. the
+// full rows of a gathered class subset.
+void GreedyDecode(const float *logits, int num_steps, size_t step_stride,
+                  const int *argmax, const float *log_norms,
+                  RecResult &result);
+
+// CTC prefix beam search over log-softmax posteriors, blank is class 0.
+// Every timestep only extends the beams with its top_k classes above
+// min_log_prob. With a grammar a beam is instead extended with the classes
+// its automaton state allows, and the best beam in an accepting state
+// wins; when no beam accepts the result is empty and not accepted. Keeps
+// its buffers between lines.
+class CTCBeamSearch {
+ public:
+  // logits of timestep t start at logits + t * step_stride, log_norms
+  // holds the log-softmax normalizer of every timestep as for GreedyDecode
+  void Decode(const float *logits, int num_steps, int num_classes,
+              size_t step_stride, const float *log_norms,
+              const CTCDecodeConfig &config, RecResult &result,
+              const FieldGrammar *grammar = nullptr);
+
+ private:
+  struct Node {
+    int parent;
+    int label;
+    // grammar state after the prefix
+    int state;
+    // best posterior of the label at a step that extended to this node
+    float prob;
+  };
+  struct Beam {
+    int node;
+    float log_blank;
+    float log_non_blank;
+  };
+
+  int Child(int node, int label, int state);
+  void Extend(const Beam &beam, float beam_total, int label, float log_prob,
+              int state);
+  void AddBeam(int node, float log_blank, float log_non_blank);
+
+  std::vector<Node> nodes_;
+  std::unordered_map<long long, int> children_;
+  std::vector<Beam> beams_;
+  std::vector<Beam> next_beams_;
+  // position of a node in next_beams_, -1 when absent
+  std::vector<int> beam_index_;
+  std::vector<std::pair<float, int>> top_classes_;
+};
+
+// Sets result.text from result.labels.
+void LabelsToText(RecResult &result);
@@ -0,0 +1,254 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+// Checks the CTC decoders, the field grammar automaton and class subset
+// decoding on small hand-made logits; no model is needed.
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include "common/test_check.h"
+#include "rec/argmax.h"
+#include "rec/class_subset.h"
+#include "rec/decode.h"
+#include "rec/field_grammar.h"
+
+// A line of logits over the whole alphabet, num_steps x num_classes.
+struct Line {
+  int num_steps;
+  int num_classes;
+  std::vector<float> logits;
+  std::vector<int> argmax;
+  std::vector<float> max_logits;
+  std::vector<float> log_norms;
+
+  Line(int steps, int classes)
+      : num_steps(steps),
+        num_classes(classes),
+        logits(size_t(steps) * classes, 0.0f) {}
+
+  float* row(int t) { return logits.data() + size_t(t) * num_classes; }
+
+  void Normalize() {
+    argmax.resize(num_steps);
+    max_logits.resize(num_steps);
+    log_norms.resize(num_steps);
+    ArgmaxRows(logits.data(), num_steps, num_classes, num_classes,
+               argmax.data(), max_logits.data());
+    LogSoftmaxNorms(logits.data(), num_steps, num_classes, num_classes,
+                    max_logits.data(), log_norms.data());
+  }
+};
+
+// Logits reading text with two steps per character and a blank between,
+// plus noise below the path. wrong_pos puts wrong_label above the true
+// character there.
+static Line MakeLine(const std::string& text, int wrong_pos, int wrong_label,
+                     std::mt19937& rng) {
+  std::vector<std::string> chars = SplitUtf8(text);
+  Line line(int(chars.size()) * 3 + 1, AlphabetSize() + 1);
+  std::uniform_real_distribution<float> noise(0.0f, 4.0f);
+  for (float& v : line.logits) v = noise(rng);
+  for (int t = 0; t < line.num_steps; t++) line.row(t)[0] += 10.0f;
+  for (size_t i = 0; i < chars.size(); i++) {
+    int label = AlphabetLabel(chars[i]);
+    for (int k = 0; k < 2; k++) {
+      float* row = line.row(int(i) * 3 + 1 + k);
+      row[0] -= 10.0f;
+      row[label] += 12.0f;
+      if (int(i) == wrong_pos) row[wrong_label] += 14.0f;
+    }
+  }
+  line.Normalize();
+  return line;
+}
+
+static void TestLogSoftmaxNorms() {
+  std::mt19937 rng(3);
+  Line line = MakeLine("110105", -1, 0, rng);
+  std::vector<float> fused(line.num_steps);
+  LogSoftmaxNorms(line.logits.data(), line.num_steps, line.num_classes,
+                  line.num_classes, nullptr, fused.data());
+  for (int t = 0; t < line.num_steps; t++) {
+    EXPECT(std::fabs(fused[t] - line.log_norms[t]) < 1e-4f,
+           "step %d: %g vs %g", t, fused[t], line.log_norms[t]);
+  }
+}
+
+static void TestGreedy() {
+  std::mt19937 rng(5);
+  Line line = MakeLine("2015.03.04", -1, 0, rng);
+  RecResult result;
+  GreedyDecode(line.logits.data(), line.num_steps, line.num_classes,
+               line.argmax.data(), line.log_norms.data(), result);
+  EXPECT(result.text == "2015.03.04", "greedy read '%s'", result.text.c_str());
+  EXPECT(result.char_probs.size() == result.labels.size(),
+         "one probability per label");
+  for (float prob : result.char_probs) {
+    EXPECT(prob > 0.5f && prob <= 1.0f, "clear characters, prob %g", prob);
+  }
+  EXPECT(result.accepted, "greedy results are always accepted");
+}
+
+// Two steps of blank 0.6 / 'a' 0.4: the argmax path reads "" with 0.36,
+// but "a" has three alignments summing to 0.64.
+static void TestBeamSumsAlignments() {
+  Line line(2, 2);
+  for (int t = 0; t < 2; t++) {
+    line.row(t)[0] = std::log(0.6f);
+    line.row(t)[1] = std::log(0.4f);
+  }
+  line.Normalize();
+  RecResult greedy;
+  GreedyDecode(line.logits.data(), 2, 2, line.argmax.data(),
+               line.log_norms.data(), greedy);
+  EXPECT(greedy.labels.empty(), "greedy takes the blank path");
+
+  CTCBeamSearch beam_search;
+  CTCDecodeConfig config;
+  config.beam_width = 4;
+  RecResult result;
+  beam_search.Decode(line.logits.data(), 2, 2, 2, line.log_norms.data(),
+                     config, result);
+  EXPECT(result.labels.size() == 1 && result.labels[0] == 1,
+         "beam search merges the alignments of 'a'");
+  EXPECT(std::fabs(result.score - std::log(0.64f)) < 1e-4f,
+         "score %g, expected log(0.64)", result.score);
+}
+
+static void TestBeamMatchesGreedyOnClearLines() {
+  std::mt19937 rng(9);
+  const char* texts[] = {"男", "1990年1月12日", "11010519491231002X"};
+  CTCBeamSearch beam_search;
+  CTCDecodeConfig config;
+  config.beam_width = 8;
+  for (const char* text : texts) {
+    Line line = MakeLine(text, -1, 0, rng);
+    RecResult result;
+    beam_search.Decode(line.logits.data(), line.num_steps, line.num_classes,
+                       line.num_classes, line.log_norms.data(), config,
+                       result);
+    EXPECT(result.text == text, "beam read '%s', expected '%s'",
+           result.text.c_str(), text);
+  }
+}
+
+static void TestFieldGrammar() {
+  FieldGrammar grammar;
+  EXPECT(!grammar.accepting(grammar.start()), "an empty grammar accepts "
+         "nothing");
+
+  // words sharing a prefix share states
+  FieldGrammar words;
+  std::vector<int> ends =
+      words.Words({words.start()}, {"土家", "土", "哈尼"});
+  words.Accept(ends);
+  EXPECT(ends.size() == 3, "three distinct ends, got %zu", ends.size());
+  EXPECT(words.num_states() == 5, "trie of 5 states, got %d",
+         words.num_states());
+  EXPECT(words.arcs(words.start()).size() == 2, "two first characters");
+
+  // four digits, then 年
+  FieldGrammar year;
+  std::vector<int> digits = year.Repeat({year.start()}, "0123456789", 4, 4);
+  year.Accept(year.Literal(digits, "年"));
+  std::vector<int> labels = year.Labels();
+  EXPECT(labels.size() == 11, "ten digits and 年, got %zu", labels.size());
+
+  // a character missing from the alphabet ends the fragment
+  FieldGrammar missing;
+  EXPECT(missing.Literal({missing.start()}, "\x01").empty(),
+         "unknown characters end in no state");
+
+  // Repeat with min 0 also ends where it started
+  FieldGrammar optional;
+  std::vector<int> optional_ends =
+      optional.Repeat({optional.start()}, "X", 0, 1);
+  EXPECT(optional_ends.size() == 2, "0 or 1 X, got %zu",
+         optional_ends.size());
+}
+
+static FieldGrammar YearGrammar() {
+  FieldGrammar grammar;
+  std::vector<int> digits =
+      grammar.Repeat({grammar.start()}, "0123456789", 4, 4);
+  grammar.Accept(grammar.Literal(digits, "年"));
+  return grammar;
+}
+
+static void TestConstrainedDecode() {
+  std::mt19937 rng(13);
+  FieldGrammar grammar = YearGrammar();
+  CTCBeamSearch beam_search;
+  CTCDecodeConfig config;
+
+  // a letter reads above the true digit, the grammar keeps the digit
+  Line line = MakeLine("1990年", 1, AlphabetLabel("B"), rng);
+  RecResult free_result;
+  beam_search.Decode(line.logits.data(), line.num_steps, line.num_classes,
+                     line.num_classes, line.log_norms.data(), config,
+                     free_result);
+  EXPECT(free_result.text.find('B') != std::string::npos,
+         "unconstrained read '%s'", free_result.text.c_str());
+  RecResult result;
+  beam_search.Decode(line.logits.data(), line.num_steps, line.num_classes,
+                     line.num_classes, line.log_norms.data(), config, result,
+                     &grammar);
+  EXPECT(result.accepted && result.text == "1990年",
+         "constrained read '%s'", result.text.c_str());
+
+  // too few characters for the grammar: nothing is accepted
+  Line short_line = MakeLine("19", -1, 0, rng);
+  beam_search.Decode(short_line.logits.data(), short_line.num_steps,
+                     short_line.num_classes, short_line.num_classes,
+                     short_line.log_norms.data(), config, result, &grammar);
+  EXPECT(!result.accepted, "a line the grammar rejects is not accepted");
+  EXPECT(result.text.empty() && result.labels.empty(),
+         "and is empty, read '%s'", result.text.c_str());
+}
+
+static void TestClassSubset() {
+  std::mt19937 rng(17);
+  FieldGrammar grammar = YearGrammar();
+  ClassSubset subset(grammar);
+  EXPECT(subset.size() == 12, "blank, ten digits and 年, got %d",
+         subset.size());
+  EXPECT(subset.classes()[0] == 0, "blank first");
+
+  Line line = MakeLine("2035年", 2, AlphabetLabel("A"), rng);
+  CTCBeamSearch beam_search;
+  CTCDecodeConfig config;
+  RecResult full;
+  beam_search.Decode(line.logits.data(), line.num_steps, line.num_classes,
+                     line.num_classes, line.log_norms.data(), config, full,
+                     &grammar);
+
+  // the gathered columns with the full-row normalizers decode the same
+  // text with the same posteriors
+  int K = subset.size();
+  std::vector<float> gathered(size_t(line.num_steps) * K);
+  subset.Gather(line.logits.data(), line.num_steps, line.num_classes,
+                gathered.data());
+  RecResult result;
+  beam_search.Decode(gathered.data(), line.num_steps, K, K,
+                     line.log_norms.data(), config, result, subset.grammar());
+  subset.ToAlphabet(result);
+  EXPECT(result.text == full.text && result.text == "2035年",
+         "subset read '%s', full '%s'", result.text.c_str(),
+         full.text.c_str());
+  EXPECT(result.char_probs == full.char_probs,
+         "subset posteriors are over the whole alphabet");
+}
+
+int main() {
+  TestLogSoftmaxNorms();
+  TestGreedy();
+  TestBeamSumsAlignments();
+  TestBeamMatchesGreedyOnClearLines();
+  TestFieldGrammar();
+  TestConstrainedDecode();
+  TestClassSubset();
+  return TestResult();
+}
@@ -0,0 +1,151 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "field_grammar.h"
+#include <algorithm>
+#include <unordered_map>
+#include "decode.h"
+
+std::vector<std::string> SplitUtf8(const std::string& text) {
+  std::vector<std::string> characters;
+  size_t pos = 0;
+  while (pos < text.size()) {
+    unsigned char lead = static_cast<unsigned char>(text[pos]);
+    size_t length = 1;
+    if (lead >= 0xF0) {
+      length = 4;
+    } else if (lead >= 0xE0) {
+      length = 3;
+    } else if (lead >= 0xC0) {
+      length = 2;
+    }
+    characters.push_back(text.substr(pos, length));
+    pos += length;
+  }
+  return characters;
+}
+
+int AlphabetLabel(const std::string& character) {
+  static const std::unordered_map<std::string, int> labels = [] {
+    std::unordered_map<std::string, int> map;
+    for (int label = 1; label <= AlphabetSize(); label++) {
+      size_t size;
+      const char* character = AlphabetChar(label, &size);
+      // the first entry wins when the table repeats a character
+      map.emplace(std::string(character, size), label);
+    }
+    return map;
+  }();
+  auto it = labels.find(character);
+  return it != labels.end() ? it->second : 0;
+}
+
+FieldGrammar::FieldGrammar() { AddState(); }
+
+std::vector<int> FieldGrammar::Labels() const {
+  std::vector<int> labels;
+  for (const std::vector<Arc>& state_arcs : arcs_) {
+    for (const Arc& arc : state_arcs) {
+      labels.push_back(arc.label);
+    }
+  }
+  std::sort(labels.begin(), labels.end());
+  labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+  return labels;
+}
+
+int FieldGrammar::AddState() {
+  arcs_.emplace_back();
+  accepting_.push_back(0);
+  return int(arcs_.size()) - 1;
+}
+
+int FieldGrammar::Next(int state, int label) const {
+  for (const Arc& arc : arcs_[state]) {
+    if (arc.label == label) return arc.next;
+  }
+  return -1;
+}
+
+void FieldGrammar::AddArc(int from, int label, int to) {
+  if (Next(from, label) < 0) {
+    arcs_[from].push_back(Arc{label, to});
+  }
+}
+
+void FieldGrammar::Accept(int state) { accepting_[state] = 1; }
+
+void FieldGrammar::Accept(const std::vector<int>& states) {
+  for (int state : states) {
+    Accept(state);
+  }
+}
+
+std::vector<int> FieldGrammar::Literal(const std::vector<int>& from,
+                                       const std::string& text) {
+  std::vector<int> ends = from;
+  for (const std::string& character : SplitUtf8(text)) {
+    int label = AlphabetLabel(character);
+    if (label == 0 || ends.empty()) return std::vector<int>();
+    int next = AddState();
+    for (int state : ends) {
+      AddArc(state, label, next);
+    }
+    ends.assign(1, next);
+  }
+  return ends;
+}
+
+std::vector<int> FieldGrammar::Repeat(const std::vector<int>& from,
+                                      const std::string& chars,
+                                      int min_count, int max_count) {
+  std::vector<int> labels;
+  for (const std::string& character : SplitUtf8(chars)) {
+    int label = AlphabetLabel(character);
+    if (label != 0) labels.push_back(label);
+  }
+  std::vector<int> ends;
+  if (min_count == 0) ends = from;
+  if (labels.empty()) return ends;
+
+  std::vector<int> current = from;
+  for (int count = 1; count <= max_count; count++) {
+    int next = AddState();
+    for (int state : current) {
+      for (int label : labels) {
+        AddArc(state, label, next);
+      }
+    }
+    current.assign(1, next);
+    if (count >= min_count) ends.push_back(next);
+  }
+  return ends;
+}
+
+std::vector<int> FieldGrammar::Words(const std::vector<int>& from,
+                                     const std::vector<std::string>& words) {
+  std::vector<int> ends;
+  for (int root : from) {
+    for (const std::string& word : words) {
+      int state = root;
+      for (const std::string& character : SplitUtf8(word)) {
+        int label = AlphabetLabel(character);
+        if (label == 0) {
+          state = -1;
+          break;
+        }
+        int next = Next(state, label);
+        if (next < 0) {
+          next = AddState();
+          AddArc(state, label, next);
+        }
+        state = next;
+      }
+      if (state >= 0 && state != root) ends.push_back(state);
+    }
+  }
+  std::sort(ends.begin(), ends.end());
+  ends.erase(std::unique(ends.begin(), ends.end()), ends.end());
+  return ends;
+}
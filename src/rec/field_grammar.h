@@ -0,0 +1,65 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <string>
+#include <vector>
+
+// A deterministic automaton over recognizer classes (AlphabetChar labels)
+// that accepts the valid values of a field. The decoder only follows its
+// arcs, so every timestep chooses among the few classes the field allows at
+// that point instead of the whole alphabet.
+//
+// Grammars are built from fragments. A fragment starts from a set of states
+// and returns the states it ends in, so fragments chain:
+//   FieldGrammar g;
+//   g.Accept(g.Literal(g.Repeat({g.start()}, "0123456789", 4, 4), "年"));
+// Fragments that leave the same state must start with different characters.
+class FieldGrammar {
+ public:
+  struct Arc {
+    int label;
+    int next;
+  };
+
+  // A grammar with only the start state, which accepts nothing.
+  FieldGrammar();
+
+  int start() const { return 0; }
+  int num_states() const { return int(arcs_.size()); }
+  bool accepting(int state) const { return accepting_[state] != 0; }
+  const std::vector<Arc>& arcs(int state) const { return arcs_[state]; }
+  // Every label on some arc, ascending.
+  std::vector<int> Labels() const;
+
+  int AddState();
+  // Ignored when from already has an arc for label.
+  void AddArc(int from, int label, int to);
+  void Accept(int state);
+  void Accept(const std::vector<int>& states);
+
+  // text read character by character. A character missing from the
+  // alphabet ends the fragment in no state.
+  std::vector<int> Literal(const std::vector<int>& from,
+                           const std::string& text);
+  // min_count to max_count characters out of chars.
+  std::vector<int> Repeat(const std::vector<int>& from,
+                          const std::string& chars, int min_count,
+                          int max_count);
+  // Any of words, as a trie so words with a common prefix share states.
+  std::vector<int> Words(const std::vector<int>& from,
+                         const std::vector<std::string>& words);
+
+ private:
+  int Next(int state, int label) const;
+
+  std::vector<std::vector<Arc>> arcs_;
+  std::vector<char> accepting_;
+};
+
+// The UTF-8 characters of text, one string each.
+std::vector<std::string> SplitUtf8(const std::string& text);
+
+// The class label of a single character, 0 when it is not in the alphabet.
+int AlphabetLabel(const std::string& character);
@@ -0,0 +1,68 @@
+# Copyright(c) TuYuAI authors.All rights reserved.
+# Licensed under the Apache-2.0 License.
+#
+# Generates alphabet_table.h from alphabet.txt, one character per line in
+# the class order of the recognizer (line i is label i + 1).
+#
+#   python gen_alphabet_table.py alphabet.txt alphabet_table.h
+
+import sys
+
+ENTRIES_PER_ROW = 16
+
+
+def c_literal(text):
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def main(src, dst):
+    with open(src, encoding='utf-8') as f:
+        chars = [line.rstrip('\r\n') for line in f]
+    if chars and chars[-1] == '':
+        chars.pop()
+
+    offsets = [0]
+    for char in chars:
+        offsets.append(offsets[-1] + len(char.encode('utf-8')))
+    # 16 bit offsets, and MSVC limits a string literal to 64 KiB
+    assert offsets[-1] < 65536, 'alphabet too large for 16 bit offsets'
+
+    lines = [
+        '// Copyright(c) TuYuAI authors.All rights reserved.',
+        '// Licensed under the Apache-2.0 License.',
+        '//',
+        '// Generated by gen_alphabet_table.py from alphabet.txt, do not edit.',
+        '',
+        '#pragma once',
+        '#include <cstdint>',
+        '',
+        'constexpr int kAlphabetSize = %d;' % len(chars),
+        '',
+        '// the UTF-8 bytes of every character back to back, not NUL separated',
+        'constexpr char kAlphabetData[] =',
+    ]
+    for i in range(0, len(chars), ENTRIES_PER_ROW):
+        row = chars[i:i + ENTRIES_PER_ROW]
+        lines.append('    ' + ' '.join(c_literal(c) for c in row))
+    lines[-1] += ';'
+    lines += [
+        '',
+        '// label l reads kAlphabetData[kAlphabetOffsets[l - 1], '
+        'kAlphabetOffsets[l])',
+        'constexpr uint16_t kAlphabetOffsets[kAlphabetSize + 1] = {',
+    ]
+    for i in range(0, len(offsets), 10):
+        row = offsets[i:i + 10]
+        lines.append('    ' + ', '.join(str(o) for o in row) + ',')
+    lines[-1] = lines[-1][:-1]
+    lines.append('};')
+
+    # the BOM makes MSVC read the characters as UTF-8
+    with open(dst, 'w', encoding='utf-8-sig', newline='\n') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit('usage: gen_alphabet_table.py alphabet.txt alphabet_table.h')
+    main(sys.argv[1], sys.argv[2])
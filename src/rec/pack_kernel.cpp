@@ -0,0 +1,119 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#include "pack_kernel.h"
+#include <algorithm>
+#include "common/bilinear.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PACK_USE_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define PACK_USE_NEON
+#endif
+
+// (v / 255 - 0.5) / 0.5 == v * kScale + kShift
+static const float kScale = 2.0f / 255.0f;
+static const float kShift = -1.0f;
+
+// horizontal pass of one source row into planar R, G, B rows of new_w
+static void ResizeRow(const unsigned char* src, int src_w, const int* xofs,
+                      const float* xalpha, int new_w, float* row) {
+  BilinearRowBGR(src, src_w, xofs, xalpha, new_w, row, row + new_w,
+                 row + 2 * new_w, 1);
+}
+
+// dst = (r0 * (1 - a) + r1 * a) * kScale + kShift
+static void BlendNormalize(const float* r0, const float* r1, float a,
+                           int size, float* dst) {
+  int i = 0;
+  float wa = a * kScale;
+  float wb = (1.0f - a) * kScale;
+#if defined(PACK_USE_SSE2)
+  __m128 va = _mm_set1_ps(wa);
+  __m128 vb = _mm_set1_ps(wb);
+  __m128 vs = _mm_set1_ps(kShift);
+  for (; i + 4 <= size; i += 4) {
+    __m128 v = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(r0 + i), vb),
+                          _mm_mul_ps(_mm_loadu_ps(r1 + i), va));
+    _mm_storeu_ps(dst + i, _mm_add_ps(v, vs));
+  }
+#elif defined(PACK_USE_NEON)
+  float32x4_t va = vdupq_n_f32(wa);
+  float32x4_t vb = vdupq_n_f32(wb);
+  float32x4_t vs = vdupq_n_f32(kShift);
+  for (; i + 4 <= size; i += 4) {
+    float32x4_t v = vmlaq_f32(vmulq_f32(vld1q_f32(r0 + i), vb),
+                              vld1q_f32(r1 + i), va);
+    vst1q_f32(dst + i, vaddq_f32(v, vs));
+  }
+#endif
+  for (; i < size; i++) {
+    dst[i] = (r0[i] * wb + r1[i] * wa) + kShift;
+  }
+}
+
+void PackBGRToCHW(const unsigned char* src, int src_w, int src_h,
+                  size_t src_step, int new_w, float* dst, int dst_w,
+                  int dst_h, int left, PackBuffers& buffers) {
+  size_t plane_size = size_t(dst_w) * dst_h;
+  new_w = std::min(new_w, dst_w - left);
+
+  // white padding on both sides of the line
+  for (int c = 0; c < 3; c++) {
+    for (int y = 0; y < dst_h; y++) {
+      float* row = dst + c * plane_size + y * dst_w;
+      std::fill(row, row + left, 1.0f);
+      std::fill(row + left + new_w, row + dst_w, 1.0f);
+    }
+  }
+  if (new_w <= 0) {
+    return;
+  }
+
+  buffers.xofs.resize(new_w);
+  buffers.xalpha.resize(new_w);
+  double scale_x = double(src_w) / new_w;
+  double scale_y = double(src_h) / dst_h;
+  for (int x = 0; x < new_w; x++) {
+    BilinearCoord(x, scale_x, src_w, &buffers.xofs[x], &buffers.xalpha[x]);
+  }
+  const int* xofs = buffers.xofs.data();
+  const float* xalpha = buffers.xalpha.data();
+
+  // the two source rows around the current output row, horizontally
+  // resized and split into planes
+  buffers.rows[0].resize(new_w * 3);
+  buffers.rows[1].resize(new_w * 3);
+  float* rows[2] = {buffers.rows[0].data(), buffers.rows[1].data()};
+  int row_y[2] = {-1, -1};
+
+  for (int y = 0; y < dst_h; y++) {
+    int y0;
+    float a;
+    BilinearCoord(y, scale_y, src_h, &y0, &a);
+    int y1 = std::min(y0 + 1, src_h - 1);
+    if (row_y[0] != y0) {
+      if (row_y[1] == y0) {
+        std::swap(rows[0], rows[1]);
+        std::swap(row_y[0], row_y[1]);
+      } else {
+        ResizeRow(src + y0 * src_step, src_w, xofs, xalpha, new_w, rows[0]);
+        row_y[0] = y0;
+      }
+    }
+    if (a != 0 && row_y[1] != y1) {
+      ResizeRow(src + y1 * src_step, src_w, xofs, xalpha, new_w, rows[1]);
+      row_y[1] = y1;
+    }
+    // with a == 0 the second row gets zero weight, any cached row will do
+    const float* r1 = a != 0 ? rows[1] : rows[0];
+    for (int c = 0; c < 3; c++) {
+      BlendNormalize(rows[0] + c * new_w, r1 + c * new_w, a, new_w,
+                     dst + c * plane_size + y * dst_w + left);
+    }
+  }
+}
@@ -0,0 +1,24 @@
+// Copyright(c) TuYuAI authors.All rights reserved.
+// Licensed under the Apache-2.0 License.
+//
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Scratch memory of PackBGRToCHW, keep it across calls to avoid
+// allocations.
+struct PackBuffers {
+  std::vector<int> xofs;
+  std::vector<float> xalpha;
+  std::vector<float> rows[2];
+};
+
+// Fused preprocessing of one text line crop. Bilinearly resizes the 8-bit
+// BGR source to new_w x dst_h and writes it as planar RGB normalized with
+// (v / 255 - 0.5) / 0.5 into dst, one 3 x dst_h x dst_w slot of the input
+// tensor. The line starts at column left, every other column is white
+// (1.0 after normalization).
+void PackBGRToCHW(const unsigned char* src, int src_w, int src_h,
+                  size_t src_step, int new_w, float* dst, int dst_w,
+                  int dst_h, int left, PackBuffers& buffers);
@@ -4,11 +4,19 @@
 
 #include "recognizer.h"
 #include <onnxruntime_c_api.h>
+#include <algorithm>
 #include <chrono>
+#include <climits>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include "common/model_cache.h"
+#include "rec/argmax.h"
 #include "spdlog/spdlog.h"
 
+static const int kParamHeight = 32;
+
 #define ORT_ABORT_ON_ERROR(expr)                                \
   do {                                                          \
     OrtStatus* onnx_status = (expr);                            \
@@ -21,6 +29,7 @@
   } while (0);
 
 Recognizer::~Recognizer() {
+  binding_.Release();
   if (session_ != nullptr) {
     ort_api_->ReleaseSession(session_);
   }
@@ -29,150 +38,297 @@ Recognizer::~Recognizer() {
   }
 }
 
-void Recognizer::InitModel(const std::string& model_path) {
-  ORT_ABORT_ON_ERROR(ort_api_->CreateSessionOptions(&session_options_));
-  ort_api_->SetIntraOpNumThreads(session_options_, 1);
-  ort_api_->SetSessionGraphOptimizationLevel(session_options_, ORT_ENABLE_ALL);
-  
+bool Recognizer::InitModel(const std::string& model_path,
+                           const SessionConfig& config) {
+  OrtStatus* status = LoadModel(model_path, config);
+  if (status != NULL) {
+    fprintf(stderr, "%s\n", ort_api_->GetErrorMessage(status));
+    ort_api_->ReleaseStatus(status);
+    return false;
+  }
+  SPDLOG_INFO("rec argmax kernel {}", ArgmaxKernelName());
+  return true;
+}
 
-#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
-  std::wstring w_model_path;
-  ORT_ABORT_ON_ERROR(ort_api_->CreateSession(env_, w_model_path.c_str(),
-      session_options_, &session_));
-#else 
-  ORT_ABORT_ON_ERROR(ort_api_->CreateSession(env_, model_path.c_str(),
-      session_options_, &session_));
-#endif 
+OrtStatus* Recognizer::LoadModel(const std::string& model_path,
+                                 const SessionConfig& config) {
+  ORT_RETURN_ON_ERROR(ort_api_->CreateSessionOptions(&session_options_));
+  ORT_RETURN_ON_ERROR(ApplySessionConfig(ort_api_, config, session_options_));
+  ORT_RETURN_ON_ERROR(CreateSessionWithCache(ort_api_, env_, model_path,
+                                             config, session_options_,
+                                             &session_));
+  return binding_.Init(ort_api_, session_, "image", {"output"});
 }
 
 std::string Recognizer::Predict(const cv::Mat& image) {
-  auto start_time = std::chrono::high_resolution_clock::now();
+  std::vector<std::string> results = PredictBatch(std::vector<cv::Mat>{image});
+  return results[0];
+}
 
-  cv::Mat out;
-  Preprocess(image, out);
+// Orders the corners as top-left, top-right, bottom-right, bottom-left.
+// Near 45 degrees the corners picked by x + y and y - x can coincide,
+// then the corners of the minimum area rectangle are ordered by their
+// angle around its center instead.
+static void OrderQuad(const std::vector<cv::Point2f>& quad, cv::Point2f* out) {
+  int picks[4] = {0, 0, 0, 0};
+  for (int i = 1; i < int(quad.size()); i++) {
+    const cv::Point2f& pt = quad[i];
+    if (pt.x + pt.y < quad[picks[0]].x + quad[picks[0]].y) picks[0] = i;
+    if (pt.y - pt.x < quad[picks[1]].y - quad[picks[1]].x) picks[1] = i;
+    if (pt.x + pt.y > quad[picks[2]].x + quad[picks[2]].y) picks[2] = i;
+    if (pt.y - pt.x > quad[picks[3]].y - quad[picks[3]].x) picks[3] = i;
+  }
+  bool distinct = true;
+  for (int a = 0; a < 4; a++) {
+    for (int b = a + 1; b < 4; b++) {
+      if (picks[a] == picks[b]) distinct = false;
+    }
+  }
+  if (distinct) {
+    for (int k = 0; k < 4; k++) {
+      out[k] = quad[picks[k]];
+    }
+    return;
+  }
 
-  int image_width = out.cols;
-  int image_height = out.rows;
-  int image_channels = out.channels();
+  cv::RotatedRect rect = cv::minAreaRect(quad);
+  cv::Point2f corners[4];
+  rect.points(corners);
+  const cv::Point2f center = rect.center;
+  // y points down, so ascending angles run clockwise from the top-left
+  std::sort(corners, corners + 4,
+            [&center](const cv::Point2f& a, const cv::Point2f& b) {
+              return std::atan2(a.y - center.y, a.x - center.x) <
+                     std::atan2(b.y - center.y, b.x - center.x);
+            });
+  int first = 0;
+  for (int k = 1; k < 4; k++) {
+    if (corners[k].x + corners[k].y < corners[first].x + corners[first].y) {
+      first = k;
+    }
+  }
+  for (int k = 0; k < 4; k++) {
+    out[k] = corners[(first + k) % 4];
+  }
+}
 
-  std::vector<int64_t> input_node_dims = {1, image_channels, image_height,
-                                          image_width};
-  size_t input_tensor_size = image_width * image_height * image_channels;
-  std::vector<float> input_tensor_values(input_tensor_size);
-
-  float* input_data = input_tensor_values.data();
-
-  for (int h = 0; h < image_height; ++h) {
-    for (int w = 0; w < image_width; ++w) {
-      int idx0 = h * image_width + w;
-      int idx1 = image_height * image_width + idx0;
-      int idx2 = 2 * image_height * image_width + idx0;
-      cv::Vec3f d = out.at<cv::Vec3f>(h, w);
-      input_tensor_values[idx0] = d[0];
-      input_tensor_values[idx1] = d[1];
-      input_tensor_values[idx2] = d[2];
+void Recognizer::WarpTextLines(
+    const cv::Mat& image,
+    const std::vector<std::vector<cv::Point2f>>& textlines) {
+  cv::Rect image_rect(0, 0, image.cols, image.rows);
+  strips_.resize(textlines.size());
+  for (size_t i = 0; i < textlines.size(); i++) {
+    cv::Point2f quad[4];
+    OrderQuad(textlines[i], quad);
+    float line_w = std::max(cv::norm(quad[1] - quad[0]),
+                            cv::norm(quad[2] - quad[3]));
+    float line_h = std::max(cv::norm(quad[3] - quad[0]),
+                            cv::norm(quad[2] - quad[1]));
+    line_h = std::max(line_h, 1.0f);
+    int strip_w = std::max(1, int(line_w * kParamHeight / line_h + 0.5f));
+
+    // warp only the region the quad covers, the strip is already 32 px
+    // high so packing it into the tensor needs no further resize
+    cv::Rect roi = cv::boundingRect(textlines[i]) & image_rect;
+    if (roi.empty()) {
+      roi = cv::Rect(0, 0, 1, 1) & image_rect;
+    }
+    cv::Point2f dst[4] = {cv::Point2f(0, 0), cv::Point2f(strip_w, 0),
+                          cv::Point2f(strip_w, kParamHeight),
+                          cv::Point2f(0, kParamHeight)};
+    for (int k = 0; k < 4; k++) {
+      quad[k].x -= roi.x;
+      quad[k].y -= roi.y;
+    }
+    cv::Mat transform = cv::getPerspectiveTransform(quad, dst);
+    cv::warpPerspective(image(roi), strips_[i], transform,
+                        cv::Size(strip_w, kParamHeight), cv::INTER_LINEAR,
+                        cv::BORDER_REPLICATE);
+  }
+}
+
+std::vector<std::string> Recognizer::PredictTextLines(
+    const cv::Mat& image,
+    const std::vector<std::vector<cv::Point2f>>& textlines) {
+  WarpTextLines(image, textlines);
+  return PredictBatch(strips_);
+}
+
+void Recognizer::PredictTextLines(
+    const cv::Mat& image,
+    const std::vector<std::vector<cv::Point2f>>& textlines,
+    std::vector<RecResult>& results) {
+  WarpTextLines(image, textlines);
+  PredictBatch(strips_, results);
+}
+
+void Recognizer::SetWidthBuckets(const std::vector<int>& width_buckets) {
+  width_buckets_ = width_buckets;
+  std::sort(width_buckets_.begin(), width_buckets_.end());
+}
+
+void Recognizer::SetDecodeConfig(const CTCDecodeConfig& decode_config) {
+  decode_config_ = decode_config;
+}
+
+std::vector<std::string> Recognizer::PredictBatch(
+    const std::vector<cv::Mat>& images) {
+  std::vector<RecResult> results;
+  PredictBatch(images, results);
+  std::vector<std::string> texts(results.size());
+  for (size_t i = 0; i < results.size(); i++) {
+    texts[i].swap(results[i].text);
+  }
+  return texts;
+}
+
+void Recognizer::PredictBatch(const std::vector<cv::Mat>& images,
+                              std::vector<RecResult>& results) {
+  PredictLines(images, std::vector<const FieldGrammar*>(),
+               std::vector<const ClassSubset*>(), results);
+}
+
+void Recognizer::PredictBatch(const std::vector<cv::Mat>& images,
+                              const std::vector<const FieldGrammar*>& grammars,
+                              std::vector<RecResult>& results) {
+  PredictLines(images, grammars, std::vector<const ClassSubset*>(), results);
+}
+
+void Recognizer::PredictBatch(const std::vector<cv::Mat>& images,
+                              const std::vector<const ClassSubset*>& subsets,
+                              std::vector<RecResult>& results) {
+  PredictLines(images, std::vector<const FieldGrammar*>(), subsets, results);
+}
+
+void Recognizer::PredictLines(const std::vector<cv::Mat>& images,
+                              const std::vector<const FieldGrammar*>& grammars,
+                              const std::vector<const ClassSubset*>& subsets,
+                              std::vector<RecResult>& results) {
+  results.assign(images.size(), RecResult());
+
+  // group crops by the smallest bucket that holds their resized width, the
+  // overflow group is keyed by INT_MAX and padded to its widest line
+  std::map<int, std::vector<int>> buckets;
+  int overflow_width = 0;
+  for (size_t i = 0; i < images.size(); i++) {
+    int new_w = ResizedWidth(images[i]);
+    auto it = std::lower_bound(width_buckets_.begin(), width_buckets_.end(),
+                               new_w);
+    if (it != width_buckets_.end()) {
+      buckets[*it].push_back(i);
+    } else {
+      buckets[INT_MAX].push_back(i);
+      overflow_width = std::max(overflow_width, new_w);
     }
   }
 
-  // create input tensor object from data values
-  OrtMemoryInfo* allocator_info;
-  ORT_ABORT_ON_ERROR(ort_api_->CreateCpuMemoryInfo(
-      OrtArenaAllocator, OrtMemTypeDefault, &allocator_info));
-  OrtValue* input_tensor = NULL;
-  ORT_ABORT_ON_ERROR(ort_api_->CreateTensorWithDataAsOrtValue(
-      allocator_info, input_tensor_values.data(),
-      input_tensor_size * sizeof(float), input_node_dims.data(), 4,
-      ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &input_tensor));
-  int is_tensor;
-  ORT_ABORT_ON_ERROR(ort_api_->IsTensor(input_tensor, &is_tensor));
-  assert(is_tensor);
-
-  OrtStatus* status;
-  const char* input_names[] = {"image"};
-  const char* output_names[] = {"output"};
-
-  OrtValue* output_tensor = NULL;
-  ORT_ABORT_ON_ERROR(ort_api_->Run(this->session_, NULL, input_names,
-                                   (const OrtValue* const*)&input_tensor, 1,
-                                   output_names, 1, &output_tensor));
-  assert(output_tensor != NULL);
-  ORT_ABORT_ON_ERROR(ort_api_->IsTensor(output_tensor, &is_tensor));
-  assert(is_tensor);
-
-  float* out_array;
-  ORT_ABORT_ON_ERROR(
-      ort_api_->GetTensorMutableData(output_tensor, (void**)&out_array));
-
-  OrtTensorTypeAndShapeInfo* output_tensor_info;
-  ORT_ABORT_ON_ERROR(
-      ort_api_->GetTensorTypeAndShape(output_tensor, &output_tensor_info));
-
-  size_t out_num_dims;
-  ORT_ABORT_ON_ERROR(
-      ort_api_->GetDimensionsCount(output_tensor_info, &out_num_dims));
-  std::vector<int64_t> output_node_dims;
-  output_node_dims.resize(out_num_dims);
-  ORT_ABORT_ON_ERROR(ort_api_->GetDimensions(
-      output_tensor_info, (int64_t*)output_node_dims.data(), out_num_dims));
+  for (auto& bucket : buckets) {
+    int param_w = bucket.first == INT_MAX ? overflow_width : bucket.first;
+    SPDLOG_DEBUG("rec bucket w = {}, batch = {}", param_w,
+                 bucket.second.size());
+    RunBatch(images, bucket.second, param_w, grammars, subsets, results);
+  }
+}
+
+void Recognizer::RunBatch(const std::vector<cv::Mat>& images,
+                          const std::vector<int>& indices, int param_w,
+                          const std::vector<const FieldGrammar*>& grammars,
+                          const std::vector<const ClassSubset*>& subsets,
+                          std::vector<RecResult>& ret_results) {
+  int batch = indices.size();
+  int image_width = param_w;
+  int image_height = kParamHeight;
+  int image_channels = 3;
 
+  std::vector<int64_t> input_node_dims = {batch, image_channels, image_height,
+                                          image_width};
+  size_t slot_size = image_channels * image_height * image_width;
+  size_t input_tensor_size = batch * slot_size;
+  input_buffer_.resize(input_tensor_size);
+  for (int n = 0; n < batch; n++) {
+    Preprocess(images[indices[n]], input_buffer_.data() + n * slot_size,
+               param_w);
+  }
+
+  ORT_ABORT_ON_ERROR(binding_.BindInput(input_buffer_.data(), input_node_dims));
+  ORT_ABORT_ON_ERROR(binding_.Run());
+  const float* out_array = binding_.output(0);
+  const std::vector<int64_t>& output_node_dims = binding_.output_shape(0);
+
+  // output layout is T x N x C, every line is decoded independently
   int64_t T = output_node_dims[0];
   int64_t N = output_node_dims[1];
   int64_t C = output_node_dims[2];
   SPDLOG_DEBUG("T = {}, N= {}, C={}\n", T, N, C);
-  std::vector<int> preds;
-  for (int t = 0; t < T; t++) {
-    int idx = 0;
-    float max_value = -10000000000.0f;
-    for (int c = 0; c < C; c++) {
-      if (out_array[t * C + c] > max_value) {
-        max_value = out_array[t * C + c];
-        idx = c;
+  assert(N == batch);
+  line_indices_.resize(T);
+  line_values_.resize(T);
+  log_norms_.resize(T);
+  for (int64_t n = 0; n < N; n++) {
+    // the timesteps of line n are N * C floats apart
+    const float* line_logits = out_array + n * C;
+    RecResult& ret_result = ret_results[indices[n]];
+    const ClassSubset* subset =
+        subsets.empty() ? nullptr : subsets[indices[n]];
+    if (subset != nullptr && subset->classes().back() < C) {
+      // The softmax still normalizes over the full row, so a line decoded
+      // from a class subset reports posteriors over the whole alphabet.
+      // That single pass over the C columns is the only full-row work,
+      // the argmax and the decoder only read the K gathered columns.
+      LogSoftmaxNorms(line_logits, int(T), int(C), N * C, nullptr,
+                      log_norms_.data());
+      int K = subset->size();
+      subset_logits_.resize(T * K);
+      subset->Gather(line_logits, int(T), N * C, subset_logits_.data());
+      if (subset->grammar() == nullptr && decode_config_.beam_width <= 1) {
+        ArgmaxRows(subset_logits_.data(), int(T), K, K, line_indices_.data(),
+                   nullptr);
       }
+      DecodeLine(subset_logits_.data(), int(T), K, K, subset->grammar(),
+                 ret_result);
+      subset->ToAlphabet(ret_result);
+      continue;
     }
-    preds.emplace_back(idx);
-    SPDLOG_DEBUG("preds is {}\n", idx);
-  }
-
-  std::vector<int> result = GreedyDecode(preds);
-
-  ort_api_->ReleaseTensorTypeAndShapeInfo(output_tensor_info);
-  ort_api_->ReleaseValue(output_tensor);
-  ort_api_->ReleaseValue(input_tensor);
-  ort_api_->ReleaseMemoryInfo(allocator_info);
-
-  std::string ret_result;
-  for (int i = 0; i < result.size(); i++) {
-    int idx = result[i];
-    ret_result += alphabets[idx - 1];
-  }
-
-  return ret_result;
-}
-
-void Recognizer::Preprocess(const cv::Mat& image, cv::Mat& out) {
-  cv::cvtColor(image, image, cv::COLOR_BGR2RGB);
-  int image_width = image.cols;
-  int image_height = image.rows;
-  int param_w = 200;
-  int param_h = 32;
-  float ratio = float(param_w) / float(param_h);
-  float h_major_ratio = float(image_height) / float(param_h);
-  int new_h = int(image_height / h_major_ratio);
-  int new_w = int(image_width / h_major_ratio);
-  SPDLOG_DEBUG("new_h = {}, new_w =  {}", new_h, new_w);
-  cv::Mat resize_image;
-  cv::resize(image, resize_image, cv::Size(new_w, new_h));
-  if (((float)image_width / image_height) < ratio) {
-    int top = (param_h - new_h) / 2;
-    int left = (param_w - new_w) / 2;
-    cv::Mat pad_image(cv::Size(param_w, param_h), image.type());
-    pad_image.setTo(cv::Scalar(255, 255, 255));
-    cv::Mat roi_image = pad_image(cv::Rect(left, top, new_w, new_h));
-    resize_image.copyTo(roi_image);
-    cv::resize(pad_image, resize_image, cv::Size(param_w, param_h));
-  }
-  cv::Mat out_float;
-  resize_image.convertTo(out_float, CV_32FC3);
-  out = out_float / 255.0f;
-  out = (out - 0.5) / 0.5;
+    ArgmaxRows(line_logits, int(T), int(C), N * C, line_indices_.data(),
+               line_values_.data());
+    LogSoftmaxNorms(line_logits, int(T), int(C), N * C, line_values_.data(),
+                    log_norms_.data());
+    DecodeLine(line_logits, int(T), int(C), N * C,
+               grammars.empty() ? nullptr : grammars[indices[n]], ret_result);
+  }
+}
+
+void Recognizer::DecodeLine(const float* logits, int num_steps,
+                            int num_classes, size_t step_stride,
+                            const FieldGrammar* grammar, RecResult& result) {
+  if (grammar != nullptr) {
+    beam_search_.Decode(logits, num_steps, num_classes, step_stride,
+                        log_norms_.data(), decode_config_, result, grammar);
+  } else if (decode_config_.beam_width <= 1) {
+    GreedyDecode(logits, num_steps, step_stride, line_indices_.data(),
+                 log_norms_.data(), result);
+  } else {
+    beam_search_.Decode(logits, num_steps, num_classes, step_stride,
+                        log_norms_.data(), decode_config_, result);
+  }
+}
+
+int Recognizer::ResizedWidth(const cv::Mat& image) const {
+  float h_major_ratio = float(image.rows) / float(kParamHeight);
+  return std::max(1, int(image.cols / h_major_ratio));
+}
+
+void Recognizer::Preprocess(const cv::Mat& input_image, float* out,
+                            int param_w) {
+  cv::Mat image = input_image;
+  if (image.type() == CV_8UC1) {
+    cv::cvtColor(input_image, image, cv::COLOR_GRAY2BGR);
+  } else if (image.type() == CV_8UC4) {
+    cv::cvtColor(input_image, image, cv::COLOR_BGRA2BGR);
+  }
+  int new_w = std::min(ResizedWidth(image), param_w);
+  int left = (param_w - new_w) / 2;
+  SPDLOG_DEBUG("new_h = {}, new_w =  {}", kParamHeight, new_w);
+  PackBGRToCHW(image.data, image.cols, image.rows, image.step, new_w, out,
+               param_w, kParamHeight, left, pack_buffers_);
 }
@@ -5,9 +5,13 @@
 #ifndef RECOGNIZER_H_
 #define RECOGNIZER_H_
 #include "common/common.h"
+#include "common/session_binding.h"
+#include "common/session_config.h"
 #include <opencv2/opencv.hpp>
 #include <string>
 #include "decode.h"
+#include "rec/class_subset.h"
+#include "rec/pack_kernel.h"
 #include "onnxruntime_c_api.h"
 
 class TUYUIDCARD_API Recognizer {
@@ -15,19 +19,95 @@ class TUYUIDCARD_API Recognizer {
   Recognizer(const OrtApi* ort_api, OrtEnv* env)
       : ort_api_(ort_api),
         env_(env),
+        session_options_(nullptr),
         session_(nullptr),
-        session_options_(nullptr) {}
+        width_buckets_({100, 200, 320, 480}) {}
   ~Recognizer();
   std::string Predict(const cv::Mat& image);
+  // Recognize several text lines. Crops are grouped by their resized width
+  // into the width buckets, every bucket runs as one Nx3x32xW batch and the
+  // results come back in the order of the input images.
+  std::vector<std::string> PredictBatch(const std::vector<cv::Mat>& images);
+  // Same with the labels and confidences of every line.
+  void PredictBatch(const std::vector<cv::Mat>& images,
+                    std::vector<RecResult>& results);
+  // Decodes every image under the grammar at the same index, lines with a
+  // nullptr grammar are decoded as free text.
+  void PredictBatch(const std::vector<cv::Mat>& images,
+                    const std::vector<const FieldGrammar*>& grammars,
+                    std::vector<RecResult>& results);
+  // Decodes every image from the class subset at the same index, lines
+  // with a nullptr subset use all classes.
+  void PredictBatch(const std::vector<cv::Mat>& images,
+                    const std::vector<const ClassSubset*>& subsets,
+                    std::vector<RecResult>& results);
 
-  void Preprocess(const cv::Mat& image, cv::Mat& out);
-  void InitModel(const std::string& onnx_model_name);
+  // Recognizes detected text lines of an image. Every quad is perspective
+  // warped to a tight 32 px high strip, so rotated or skewed lines do not
+  // pull in their neighbours the way an axis-aligned crop does.
+  std::vector<std::string> PredictTextLines(
+      const cv::Mat& image,
+      const std::vector<std::vector<cv::Point2f>>& textlines);
+  void PredictTextLines(const cv::Mat& image,
+                        const std::vector<std::vector<cv::Point2f>>& textlines,
+                        std::vector<RecResult>& results);
+
+  // Widths in ascending order that text lines are padded to. Lines wider
+  // than the last bucket are batched together at their own widest width.
+  void SetWidthBuckets(const std::vector<int>& width_buckets);
+  // Greedy by default, a beam width above 1 runs the prefix beam search.
+  void SetDecodeConfig(const CTCDecodeConfig& decode_config);
+
+  int ResizedWidth(const cv::Mat& image) const;
+  // Writes the crop, resized to 32 px high and centered in param_w white
+  // columns, as one normalized 3x32xparam_w slot of the input tensor.
+  void Preprocess(const cv::Mat& image, float* out, int param_w);
+  // Returns false when the model can not be loaded, the error is printed.
+  bool InitModel(const std::string& onnx_model_name,
+                 const SessionConfig& config = SessionConfig());
 
  private:
+  OrtStatus* LoadModel(const std::string& model_path,
+                       const SessionConfig& config);
+  void WarpTextLines(const cv::Mat& image,
+                     const std::vector<std::vector<cv::Point2f>>& textlines);
+  // grammars and subsets are empty or hold one entry per image
+  void PredictLines(const std::vector<cv::Mat>& images,
+                    const std::vector<const FieldGrammar*>& grammars,
+                    const std::vector<const ClassSubset*>& subsets,
+                    std::vector<RecResult>& results);
+  void RunBatch(const std::vector<cv::Mat>& images,
+                const std::vector<int>& indices, int param_w,
+                const std::vector<const FieldGrammar*>& grammars,
+                const std::vector<const ClassSubset*>& subsets,
+                std::vector<RecResult>& ret_results);
+  // decodes with line_indices_ as the argmax path and log_norms_
+  void DecodeLine(const float* logits, int num_steps, int num_classes,
+                  size_t step_stride, const FieldGrammar* grammar,
+                  RecResult& result);
+
   const OrtApi* ort_api_;
   OrtEnv* env_;
   OrtSessionOptions* session_options_;
   OrtSession* session_;
+  // input_buffer_ bound as "image", the output kept between runs
+  SessionBinding binding_;
+  std::vector<int> width_buckets_;
+  CTCDecodeConfig decode_config_;
+  CTCBeamSearch beam_search_;
+
+  // rectified line strips, input tensor and preprocessing scratch reused
+  // across batches
+  std::vector<cv::Mat> strips_;
+  std::vector<float> input_buffer_;
+  PackBuffers pack_buffers_;
+  // best class and its logit for every timestep of a line
+  std::vector<int> line_indices_;
+  std::vector<float> line_values_;
+  // log-softmax normalizer of every timestep of a line
+  std::vector<float> log_norms_;
+  // the subset columns of a line's logits
+  std::vector<float> subset_logits_;
 };
 
 #endif 
\ No newline at end of file
@@ -17,7 +17,9 @@ int main(int argc, char* argv[]) {
   OrtEnv* env;
   g_ort->CreateEnv(ORT_LOGGING_LEVEL_WARNING, "idcard", &env);
   Recognizer recognizer(g_ort, env);
-  recognizer.InitModel(model_path);
+  if (!recognizer.InitModel(model_path)) {
+    return 1;
+  }
   cv::Mat image = cv::imread(image_path);
   std::string res = recognizer.Predict(image);
   std::cout << res << std::endl;